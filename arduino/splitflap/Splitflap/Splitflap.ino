@@ -36,6 +36,7 @@
 #include <Wire.h>
 
 #include "config.h"
+#include "src/character_lookup.h"
 #include "src/splitflap_module.h"
 
 #if SPI_IO
@@ -184,20 +185,6 @@ void setup() {
 }
 
 
-inline int8_t FindFlapIndex(uint8_t character, uint8_t current_flap_index) {
-    for (uint8_t i = current_flap_index; i < NUM_FLAPS; i++) {
-        if (character == flaps[i]) {
-          return i;
-        }
-    }
-    for (uint8_t i = 0; i < current_flap_index; i++) {
-        if (character == flaps[i]) {
-          return i;
-        }
-    }
-    return -1;
-}
-
 bool pending_move_response = true;
 bool pending_no_op = false;
 uint8_t recv_count = 0;
@@ -229,8 +216,8 @@ inline void run_iteration() {
     uint32_t iterationStartMillis = millis();
     boolean all_idle = true;
     boolean all_stopped = true;
+    module_bank.Update();
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-      modules[i]->Update();
       bool is_idle = modules[i]->state == PANIC
         || modules[i]->state == STATE_DISABLED
         || modules[i]->state == LOOK_FOR_HOME
@@ -390,8 +377,8 @@ inline void run_iteration() {
               }
 #endif
               for (uint8_t i = 0; i < recv_count; i++) {
-                int8_t index = FindFlapIndex(recv_buffer[i], modules[i]->GetCurrentFlapIndex());
-                if (index != -1) {
+                uint8_t index = CharacterLookup::FindFlapIndex(recv_buffer[i], modules[i]->GetCurrentFlapIndex());
+                if (index != CharacterLookup::NOT_FOUND) {
                   if (FORCE_FULL_ROTATION || index != modules[i]->GetTargetFlapIndex()) {
                     modules[i]->GoToFlapIndex(index);
                   }
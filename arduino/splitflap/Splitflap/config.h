@@ -20,12 +20,20 @@
 // testing the split-flap, since home calibration can be tricky to fine tune)
 #define HOME_CALIBRATION_ENABLED true
 
+// Whether to drive the motors in half steps rather than full steps. Half stepping
+// gives smoother torque, so modules can cruise faster without skipping, at the
+// cost of twice as many updates per second (motion profiles keep the same
+// speed in full steps unless retuned).
+#ifndef HALF_STEP
+#define HALF_STEP false
+#endif
+
 // 3) Flap Contents & Order
 #define NUM_FLAPS (40)
 
 // This should match the order of flaps on the spool, with the first being the
 // "home" flap.
-const uint8_t flaps[NUM_FLAPS] = {
+constexpr uint8_t flaps[NUM_FLAPS] = {
   ' ',
   'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
   'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
@@ -126,4 +134,20 @@ const uint8_t flaps[NUM_FLAPS] = {
 #ifdef CHAINLINK
 #define NUM_LOOPBACKS (NUM_MODULES / 3)
 #define CHAINLINK_ENFORCE_LOOPBACKS 1
+
+// Whether to count the driver boards actually connected at boot (via their
+// loopbacks), rather than requiring exactly NUM_MODULES modules. NUM_MODULES
+// is then the most modules supported, and any beyond the last board found are
+// left disabled.
+#ifndef CHAINLINK_DISCOVER_BOARDS
+#define CHAINLINK_DISCOVER_BOARDS true
+#endif
+
+// Whether to keep checking loopbacks while running with binary-coded patterns
+// that cover every loopback at once, rather than one loopback at a time. A
+// fault is then found within 2 * log2(NUM_LOOPBACKS) patterns rather than
+// NUM_LOOPBACKS.
+#ifndef CHAINLINK_BINARY_LOOPBACK_CHECK
+#define CHAINLINK_BINARY_LOOPBACK_CHECK true
+#endif
 #endif
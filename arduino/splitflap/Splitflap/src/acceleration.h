@@ -14,14 +14,202 @@
    limitations under the License.
 */
 
-// NOTE: THIS FILE IS AUTOGENERATED! DO NOT MODIFY!
-// To update, run `arduino/splitflap/Splitflap/src/generate_acceleration.py`
-
 #ifndef ACCELERATION
 #define ACCELERATION
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include "index_sequence.h"
+#include "../config.h"
+
+// Parameters for the default acceleration ramp; override with build flags to tune without editing code. Periods are
+// per full motor step, regardless of HALF_STEP.
+
+// Step period at full speed
+#ifndef ACCEL_MIN_PERIOD_MICROS
+#define ACCEL_MIN_PERIOD_MICROS 1600
+#endif
+
+// Step period when starting from rest
+#ifndef ACCEL_MAX_PERIOD_MICROS
+#define ACCEL_MAX_PERIOD_MICROS 10000
+#endif
+
+// Time taken to accelerate from rest to full speed
+#ifndef ACCEL_TIME_MICROS
+#define ACCEL_TIME_MICROS 200000
+#endif
+
+// Update period while stopped
+#ifndef ACCEL_IDLE_PERIOD_MICROS
+#define ACCEL_IDLE_PERIOD_MICROS 1600
+#endif
+
+// Period of a single driver step, given the period of a full motor step
+#define STEP_PERIOD_MICROS(full_step_micros) ((full_step_micros) / (HALF_STEP ? 2 : 1))
+
 namespace Acceleration {
-    const PROGMEM uint16_t ACCEL_STEP_PERIODS[] = {1600, 10000, 7920, 6800, 6064, 5530, 5119, 4790, 4518, 4288, 4090, 3918, 3766, 3631, 3510, 3400, 3300, 3208, 3123, 3045, 2973, 2906, 2843, 2783, 2728, 2676, 2626, 2580, 2535, 2493, 2453, 2415, 2379, 2344, 2310, 2278, 2248, 2218, 2190, 2163, 2137, 2111, 2087, 2063, 2040, 2018, 1997, 1976, 1956, 1937, 1918, 1900, 1882, 1864, 1848, 1831, 1815, 1800, 1784, 1770, 1755, 1741, 1727, 1714, 1701, 1688, 1675, 1663, 1651, 1639, 1628, 1617, 1606};
-    const uint8_t MAX_ACCEL_STEP = 72;
+
+/**
+ * Velocity increasing linearly with time, from 1/MaxPeriod to 1/MinPeriod over AccelTime. Acceleration is constant,
+ * so jerk is unbounded at either end of the ramp.
+ */
+template <uint32_t MinPeriod, uint32_t MaxPeriod, uint32_t AccelTime>
+struct LinearVelocity {
+    static_assert(MinPeriod > 0, "Minimum period must be positive");
+    static_assert(MinPeriod <= MaxPeriod, "Minimum period must not exceed maximum period");
+    static_assert(MaxPeriod <= 65535, "Periods must fit in a uint16_t");
+
+    static constexpr uint32_t ACCEL_TIME = AccelTime;
+
+    // Step period at time t into the ramp. Equivalent to 1/v for v = v_min + (v_max - v_min) * t / AccelTime
+    static constexpr uint16_t PeriodAt(uint32_t t) {
+        return (uint16_t)((uint64_t)AccelTime * MinPeriod * MaxPeriod
+                / ((uint64_t)AccelTime * MinPeriod + (uint64_t)(MaxPeriod - MinPeriod) * t));
+    }
+};
+
+/**
+ * Velocity following a smoothstep (3x^2 - 2x^3) curve from 1/MaxPeriod to 1/MinPeriod over AccelTime. Acceleration
+ * builds up from and falls back to zero, so jerk stays bounded; covers the same distance as LinearVelocity over the
+ * same time, but is much gentler on the motor at either end of the ramp.
+ */
+template <uint32_t MinPeriod, uint32_t MaxPeriod, uint32_t AccelTime>
+struct SCurveVelocity {
+    static_assert(MinPeriod > 0, "Minimum period must be positive");
+    static_assert(MinPeriod <= MaxPeriod, "Minimum period must not exceed maximum period");
+    static_assert(MaxPeriod <= 65535, "Periods must fit in a uint16_t");
+
+    static constexpr uint32_t ACCEL_TIME = AccelTime;
+
+    // Fraction of the ramp elapsed at time t, in 1/65536ths
+    static constexpr uint32_t Progress(uint32_t t) {
+        return t >= AccelTime ? 65536 : (uint32_t)((uint64_t)t * 65536 / AccelTime);
+    }
+
+    // Smoothstep of x, both in 1/65536ths
+    static constexpr uint32_t Smoothstep(uint64_t x) {
+        return (uint32_t)((3 * x * x - 2 * x * x * x / 65536) / 65536);
+    }
+
+    // Step period at time t into the ramp. Equivalent to 1/v for v = v_min + (v_max - v_min) * smoothstep(t / AccelTime)
+    static constexpr uint16_t PeriodAt(uint32_t t) {
+        return (uint16_t)((uint64_t)MinPeriod * MaxPeriod * 65536
+                / ((uint64_t)MinPeriod * 65536 + (uint64_t)(MaxPeriod - MinPeriod) * Smoothstep(Progress(t))));
+    }
+};
+
+/**
+ * An acceleration ramp following the given velocity curve, with one table entry per step. Entry 0 is the update
+ * period at rest; entry MAX_ACCEL_STEP is full speed. Deceleration runs through the same entries in reverse.
+ *
+ * The table is computed entirely at compile time (in integer arithmetic, so it doesn't depend on the target's
+ * floating point precision) and stored in PROGMEM; only ramps that are actually referenced end up in the image.
+ */
+template <typename Velocity, uint32_t IdlePeriod>
+struct Ramp {
+    static_assert(IdlePeriod <= 65535, "Periods must fit in a uint16_t");
+
+    // Number of steps (i.e. ramp entries) taken to reach the end of the ramp, starting from time t
+    static constexpr uint16_t StepsFrom(uint32_t t) {
+        return t >= Velocity::ACCEL_TIME ? 0 : 1 + StepsFrom(t + Velocity::PeriodAt(t));
+    }
+
+    // Time into the ramp after taking the given number of steps from time t
+    static constexpr uint32_t TimeAfter(uint32_t t, uint16_t steps) {
+        return steps == 0 ? t : TimeAfter(t + Velocity::PeriodAt(t), steps - 1);
+    }
+
+    static constexpr uint16_t Entry(uint16_t k) {
+        return k == 0 ? IdlePeriod : Velocity::PeriodAt(TimeAfter(0, k - 1));
+    }
+
+    static_assert(StepsFrom(0) <= 255, "Number of ramp steps would exceed a uint8_t");
+
+    static constexpr uint8_t MAX_ACCEL_STEP = StepsFrom(0);
+
+    // Step period at full speed
+    static constexpr uint16_t FULL_SPEED_PERIOD = Entry(MAX_ACCEL_STEP);
+
+    template <typename Sequence>
+    struct Table;
+
+    template <size_t... K>
+    struct Table<IndexSequence<K...>> {
+        static const uint16_t PERIODS[sizeof...(K)];
+    };
+
+    typedef Table<typename MakeIndexSequence<MAX_ACCEL_STEP + 1>::type> Periods;
+};
+
+template <typename Velocity, uint32_t IdlePeriod>
+constexpr uint8_t Ramp<Velocity, IdlePeriod>::MAX_ACCEL_STEP;
+
+template <typename Velocity, uint32_t IdlePeriod>
+constexpr uint16_t Ramp<Velocity, IdlePeriod>::FULL_SPEED_PERIOD;
+
+template <typename Velocity, uint32_t IdlePeriod>
+template <size_t... K>
+const PROGMEM uint16_t Ramp<Velocity, IdlePeriod>::Table<IndexSequence<K...>>::PERIODS[sizeof...(K)] = {
+    Ramp<Velocity, IdlePeriod>::Entry(K)...
+};
+
+template <uint32_t MinPeriod, uint32_t MaxPeriod, uint32_t AccelTime, uint32_t IdlePeriod>
+using LinearRamp = Ramp<LinearVelocity<MinPeriod, MaxPeriod, AccelTime>, IdlePeriod>;
+
+template <uint32_t MinPeriod, uint32_t MaxPeriod, uint32_t AccelTime, uint32_t IdlePeriod>
+using SCurveRamp = Ramp<SCurveVelocity<MinPeriod, MaxPeriod, AccelTime>, IdlePeriod>;
+
+// Named profiles. Fast is the default used for normal motion.
+typedef LinearRamp<STEP_PERIOD_MICROS(ACCEL_MIN_PERIOD_MICROS), STEP_PERIOD_MICROS(ACCEL_MAX_PERIOD_MICROS),
+        ACCEL_TIME_MICROS, ACCEL_IDLE_PERIOD_MICROS> Fast;
+
+// Lower top speed and gentler acceleration, for quieter operation
+typedef LinearRamp<STEP_PERIOD_MICROS(2400), STEP_PERIOD_MICROS(10000), 300000, ACCEL_IDLE_PERIOD_MICROS> Quiet;
+
+// Same speeds and ramp time as Fast, without the jolt at either end
+typedef SCurveRamp<STEP_PERIOD_MICROS(ACCEL_MIN_PERIOD_MICROS), STEP_PERIOD_MICROS(ACCEL_MAX_PERIOD_MICROS),
+        ACCEL_TIME_MICROS, ACCEL_IDLE_PERIOD_MICROS> SCurve;
+
+// Higher top speed than Fast; the S-curve's gentle start and finish keep the motor from skipping steps getting there
+typedef SCurveRamp<STEP_PERIOD_MICROS(1200), STEP_PERIOD_MICROS(10000), 250000, ACCEL_IDLE_PERIOD_MICROS> SCurveFast;
+
+constexpr const uint16_t* ACCEL_STEP_PERIODS = Fast::Periods::PERIODS;
+const uint8_t MAX_ACCEL_STEP = Fast::MAX_ACCEL_STEP;
+
+/**
+ * Motion profiles that can be selected per module at runtime (see SplitflapModuleBank::SetMotionProfile). Values
+ * match the MotionProfile enum in splitflap.proto.
+ */
+enum Profile {
+    PROFILE_DEFAULT,
+    PROFILE_QUIET,
+    PROFILE_S_CURVE,
+    PROFILE_S_CURVE_FAST,
+    NUM_PROFILES,
+};
+
+struct ProfileInfo {
+    // Ramp table in PROGMEM
+    const uint16_t* periods;
+    uint8_t max_accel_step;
+};
+
+const ProfileInfo PROFILES[NUM_PROFILES] = {
+    {Fast::Periods::PERIODS, Fast::MAX_ACCEL_STEP},
+    {Quiet::Periods::PERIODS, Quiet::MAX_ACCEL_STEP},
+    {SCurve::Periods::PERIODS, SCurve::MAX_ACCEL_STEP},
+    {SCurveFast::Periods::PERIODS, SCurveFast::MAX_ACCEL_STEP},
+};
+
+constexpr uint16_t Min(uint16_t a, uint16_t b) {
+    return a < b ? a : b;
+}
+
+// Shortest step period of any profile
+constexpr uint16_t MIN_STEP_PERIOD = Min(Min(Fast::FULL_SPEED_PERIOD, Quiet::FULL_SPEED_PERIOD),
+        Min(SCurve::FULL_SPEED_PERIOD, SCurveFast::FULL_SPEED_PERIOD));
+
 }
 #endif
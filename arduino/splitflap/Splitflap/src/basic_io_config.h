@@ -21,6 +21,13 @@
 
 #include "splitflap_module.h"
 
+ModuleBank module_bank;
+
+// Static buffer for SplitflapModule views onto module_bank (initialized at runtime)
+static char moduleBuffer[NUM_MODULES][sizeof(SplitflapModule)];
+
+SplitflapModule* modules[NUM_MODULES];
+
 #if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__)
   #if NUM_MODULES > 3
   #error "Basic IO mode only supports up to 3 modules on Atmega168/328-based boards. Set NUM_MODULES to 3 or fewer."
@@ -33,17 +40,17 @@
   // Sensor B: PC4 = pin A4
   // Sensor C: PC5 = pin A5
 
-  SplitflapModule moduleA((uint8_t&)PORTB, 0, (uint8_t&)PINB, B00010000);
-  SplitflapModule moduleB((uint8_t&)PORTD, 4, (uint8_t&)PINC, B00010000);
-  SplitflapModule moduleC((uint8_t&)PORTC, 0, (uint8_t&)PINC, B00100000);
-
-  SplitflapModule* modules[] = {
-    &moduleA,
-    &moduleB,
-    &moduleC,
-  };
+  static uint8_t* const MOTOR_PORTS[] = {(uint8_t*)&PORTB, (uint8_t*)&PORTD, (uint8_t*)&PORTC};
+  static const uint8_t MOTOR_BITSHIFTS[] = {0, 4, 0};
+  static uint8_t* const SENSOR_PINS[] = {(uint8_t*)&PINB, (uint8_t*)&PINC, (uint8_t*)&PINC};
+  static const uint8_t SENSOR_BITMASKS[] = {B00010000, B00010000, B00100000};
 
   void initialize_modules() {
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+      module_bank.Configure(i, *MOTOR_PORTS[i], MOTOR_BITSHIFTS[i], *SENSOR_PINS[i], SENSOR_BITMASKS[i]);
+      modules[i] = new (moduleBuffer[i]) SplitflapModule(module_bank, i);
+    }
+
     // Initialize motor outputs
     DDRB |= 0xF; // Motor A
     DDRD |= 0xF0; // Motor B
@@ -56,39 +63,51 @@
   }
 
   inline void motor_sensor_io() {
-    // No-op (modules write directly to IO pins)
+    // Modules write directly to IO pins, so there's just the home sensors to read
+    module_bank.ReadSensors();
   }
 #elif defined(__AVR_ATmega2560__)
+  #if NUM_MODULES > 12
+  #error "Basic IO mode only supports up to 12 modules on Atmega2560-based boards. Set NUM_MODULES to 12 or fewer."
+  #endif
 
-  SplitflapModule moduleA((uint8_t&)PORTB, 4, (uint8_t&)PINE, 1 << 5); //10-13    3
-  SplitflapModule moduleB((uint8_t&)PORTA, 0, (uint8_t&)PINE, 1 << 4); //25-22    2
-  SplitflapModule moduleC((uint8_t&)PORTA, 4, (uint8_t&)PINJ, 1 << 1); //29-26    14
-  SplitflapModule moduleD((uint8_t&)PORTC, 4, (uint8_t&)PINJ, 1 << 0); //33-30    15
-  SplitflapModule moduleE((uint8_t&)PORTC, 0, (uint8_t&)PINH, 1 << 1); //37-34    16
-  SplitflapModule moduleF((uint8_t&)PORTL, 4, (uint8_t&)PINH, 1 << 0); //45-42    17
-  SplitflapModule moduleG((uint8_t&)PORTL, 0, (uint8_t&)PIND, 1 << 3); //49-46    18
-  SplitflapModule moduleH((uint8_t&)PORTB, 0, (uint8_t&)PIND, 1 << 2); //53-50    19
-  SplitflapModule moduleI((uint8_t&)PORTK, 4, (uint8_t&)PIND, 1 << 7); //A12-A15  38
-  SplitflapModule moduleJ((uint8_t&)PORTK, 0, (uint8_t&)PING, 1 << 2); //A8-A11   39
-  SplitflapModule moduleK((uint8_t&)PORTF, 4, (uint8_t&)PING, 1 << 1); //A4-A7    40
-  SplitflapModule moduleL((uint8_t&)PORTF, 0, (uint8_t&)PING, 1 << 0); //A0-A3    41
-
-  SplitflapModule* modules[] = {
-    &moduleA,
-    &moduleB,
-    &moduleC,
-    &moduleD,
-    &moduleE,
-    &moduleF,
-    &moduleG,
-    &moduleH,
-    &moduleI,
-    &moduleJ,
-    &moduleK,
-    &moduleL,
+  static uint8_t* const MOTOR_PORTS[] = {
+    (uint8_t*)&PORTB, //10-13
+    (uint8_t*)&PORTA, //25-22
+    (uint8_t*)&PORTA, //29-26
+    (uint8_t*)&PORTC, //33-30
+    (uint8_t*)&PORTC, //37-34
+    (uint8_t*)&PORTL, //45-42
+    (uint8_t*)&PORTL, //49-46
+    (uint8_t*)&PORTB, //53-50
+    (uint8_t*)&PORTK, //A12-A15
+    (uint8_t*)&PORTK, //A8-A11
+    (uint8_t*)&PORTF, //A4-A7
+    (uint8_t*)&PORTF, //A0-A3
   };
+  static const uint8_t MOTOR_BITSHIFTS[] = {4, 0, 4, 4, 0, 4, 0, 0, 4, 0, 4, 0};
+  static uint8_t* const SENSOR_PINS[] = {
+    (uint8_t*)&PINE, //3
+    (uint8_t*)&PINE, //2
+    (uint8_t*)&PINJ, //14
+    (uint8_t*)&PINJ, //15
+    (uint8_t*)&PINH, //16
+    (uint8_t*)&PINH, //17
+    (uint8_t*)&PIND, //18
+    (uint8_t*)&PIND, //19
+    (uint8_t*)&PIND, //38
+    (uint8_t*)&PING, //39
+    (uint8_t*)&PING, //40
+    (uint8_t*)&PING, //41
+  };
+  static const uint8_t SENSOR_BITMASKS[] = {1 << 5, 1 << 4, 1 << 1, 1 << 0, 1 << 1, 1 << 0, 1 << 3, 1 << 2, 1 << 7, 1 << 2, 1 << 1, 1 << 0};
 
   void initialize_modules() {
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+      module_bank.Configure(i, *MOTOR_PORTS[i], MOTOR_BITSHIFTS[i], *SENSOR_PINS[i], SENSOR_BITMASKS[i]);
+      modules[i] = new (moduleBuffer[i]) SplitflapModule(module_bank, i);
+    }
+
     // Initialize motor outputs
     DDRF = 0xFF;
     DDRK = 0xFF;
@@ -113,7 +132,8 @@
   }
 
   inline void motor_sensor_io() {
-    // No-op (modules write directly to IO pins)
+    // Modules write directly to IO pins, so there's just the home sensors to read
+    module_bank.ReadSensors();
   }
 #else
   #error "Basic IO configuration is not supported for this board type. Use SPI IO or modify basic_io_config.h to add support for this board."
@@ -0,0 +1,85 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef CHARACTER_LOOKUP_H
+#define CHARACTER_LOOKUP_H
+
+#include <stdint.h>
+
+#include "index_sequence.h"
+#include "../config.h"
+
+/**
+ * Reverse lookup from character to flap index for the flaps[] defined in config.h, generated at compile time and stored
+ * in PROGMEM, so finding a character's flap is a table read rather than a scan of every flap. Characters that appear on
+ * several flaps are chained together, so the search can still prefer the next copy from the current flap onwards.
+ */
+namespace CharacterLookup {
+
+const uint8_t NOT_FOUND = 0xFF;
+
+// Index of the first flap showing exactly the given character, searching from flap i
+constexpr uint8_t FindExact(uint8_t character, uint8_t i) {
+    return i >= NUM_FLAPS ? NOT_FOUND : flaps[i] == character ? i : FindExact(character, i + 1);
+}
+
+// Index of the next flap after flap i showing the same character, or NOT_FOUND
+constexpr uint8_t FindDuplicate(uint8_t i) {
+    return FindExact(flaps[i], i + 1);
+}
+
+template <typename Sequence>
+struct Table;
+
+template <size_t... C>
+struct Table<IndexSequence<C...>> {
+    static const uint8_t FLAP_INDEX[sizeof...(C)];
+};
+
+template <size_t... C>
+const PROGMEM uint8_t Table<IndexSequence<C...>>::FLAP_INDEX[sizeof...(C)] = {
+    FindExact(C, 0)...
+};
+
+template <typename Sequence>
+struct DuplicateTable;
+
+template <size_t... I>
+struct DuplicateTable<IndexSequence<I...>> {
+    static const uint8_t NEXT_FLAP_INDEX[sizeof...(I)];
+};
+
+template <size_t... I>
+const PROGMEM uint8_t DuplicateTable<IndexSequence<I...>>::NEXT_FLAP_INDEX[sizeof...(I)] = {
+    FindDuplicate(I)...
+};
+
+typedef Table<MakeIndexSequence<256>::type> Default;
+typedef DuplicateTable<MakeIndexSequence<NUM_FLAPS>::type> Duplicates;
+
+// Index of the first flap from start onwards (wrapping around) showing exactly the given character, or NOT_FOUND
+inline uint8_t FindFlapIndex(uint8_t character, uint8_t start) {
+    uint8_t first = pgm_read_byte_near(Default::FLAP_INDEX + character);
+    for (uint8_t i = first; i != NOT_FOUND; i = pgm_read_byte_near(Duplicates::NEXT_FLAP_INDEX + i)) {
+        if (i >= start) {
+            return i;
+        }
+    }
+    return first;
+}
+
+}
+#endif
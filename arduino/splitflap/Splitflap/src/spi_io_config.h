@@ -19,6 +19,16 @@
 
 #include <SPI.h>
 
+#include "index_sequence.h"
+
+// Number of independent shift register chains to split the modules across (ESP32 only; see SECOND_CHAIN_FIRST_MODULE).
+// The chains are clocked at the same time, each on its own SPI host, so frame time is that of the longest chain rather
+// than of all modules in series. Wire LATCH_PIN to every chain, so they latch together. With Chainlink board discovery,
+// only the last chain may be short.
+#ifndef NUM_IO_CHAINS
+#define NUM_IO_CHAINS 1
+#endif
+
 #if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__)
   #define OUT_LATCH_PIN (4)
   #define _OUT_LATCH_PORT PORTD
@@ -54,6 +64,19 @@
   #define BUFFER_ATTRS
 #endif
 
+#ifdef SPLITFLAP_NATIVE_SHIM
+  // Host build, wired to whatever the shim has attached (e.g. the emulated Chainlink chain in native/chainlink)
+  #define OUT_LATCH_PIN (4)
+  #define IN_LATCH_PIN (5)
+
+  #define OUT_LATCH() {digitalWrite(OUT_LATCH_PIN, HIGH); digitalWrite(OUT_LATCH_PIN, LOW);}
+  #define IN_LATCH() {digitalWrite(IN_LATCH_PIN, LOW); digitalWrite(IN_LATCH_PIN, HIGH);}
+
+  #define SPI_CLOCK 4000000
+
+  #define BUFFER_ATTRS
+#endif
+
 #ifdef ESP32
   #include "driver/spi_master.h"
   #include "driver/spi_slave.h"
@@ -78,41 +101,234 @@
   #define SPI_HOST HSPI_HOST
   #define DMA_CHANNEL 1
 
-
+  #if NUM_IO_CHAINS > 1
+  #if defined(ENABLE_DISPLAY) && ENABLE_DISPLAY
+  #error "The second I/O chain uses VSPI, which the ST7789 display driver needs; set ENABLE_DISPLAY=false"
+  #endif
+  #define SECOND_CHAIN_SPI_HOST VSPI_HOST
+  #define SECOND_CHAIN_DMA_CHANNEL 2
+
+  #ifndef SECOND_CHAIN_PIN_NUM_MISO
+  #define SECOND_CHAIN_PIN_NUM_MISO 36
+  #endif
+  #ifndef SECOND_CHAIN_PIN_NUM_MOSI
+  #define SECOND_CHAIN_PIN_NUM_MOSI 13
+  #endif
+  #ifndef SECOND_CHAIN_PIN_NUM_CLK
+  #define SECOND_CHAIN_PIN_NUM_CLK 14
+  #endif
+  #endif
+
+
+  // Whether motor_sensor_io_pipelined() overlaps each frame's transfer with computing the next (see below). Sensor
+  // readings are then a frame older. Off by default: it can only hide the CPU's share of a frame, which the native
+  // Chainlink emulator puts at around 1% of the bus time at the default SPI_CLOCK (on a desktop CPU; the ESP32 is
+  // slower), so it's mainly of use with a faster SPI clock. Compare with IO_STATS_LOGGING=true.
+  #ifndef ASYNC_MOTOR_SENSOR_IO
+  #define ASYNC_MOTOR_SENSOR_IO false
+  #endif
+
+  // Whether to shift motor outputs out and sensor inputs in with a single full-duplex transaction (in SPI mode 0, like
+  // the AVR path), rather than a transmit and then a half-duplex receive transaction. This halves bus time per frame on
+  // long chains, but samples the 74HC165s on the same clock edge that shifts them; disable if sensor readings are
+  // unreliable with your driver boards.
+  // Multiple chains are always full-duplex, as the latch is then driven around the whole frame rather than by each
+  // chain's transactions.
+  #ifndef FULL_DUPLEX_MOTOR_SENSOR_IO
+  #define FULL_DUPLEX_MOTOR_SENSOR_IO (NUM_IO_CHAINS > 1)
+  #endif
+  #if NUM_IO_CHAINS > 1 && !FULL_DUPLEX_MOTOR_SENSOR_IO
+  #error "Multiple I/O chains require FULL_DUPLEX_MOTOR_SENSOR_IO"
+  #endif
+
+#if FULL_DUPLEX_MOTOR_SENSOR_IO
+  spi_device_handle_t spi_io[NUM_IO_CHAINS];
+  spi_transaction_t io_transaction[NUM_IO_CHAINS];
+#else
   spi_device_handle_t spi_tx;
   spi_device_handle_t spi_rx;
 
   spi_transaction_t tx_transaction;
   spi_transaction_t rx_transaction;
+#endif
 
-
+  // Whether a frame has been queued and not yet collected by motor_sensor_io_finish()
+  bool motor_sensor_io_in_flight = false;
 #endif
 
-#if !defined(__AVR_ATmega168__) && !defined(__AVR_ATmega328P__) && !defined(ARDUINO_ESP8266_WEMOS_D1MINI) && !defined(ESP32)
+#if !defined(__AVR_ATmega168__) && !defined(__AVR_ATmega328P__) && !defined(ARDUINO_ESP8266_WEMOS_D1MINI) && !defined(ESP32) && !defined(SPLITFLAP_NATIVE_SHIM)
 #error "Unknown/unsupported board for SPI mode. ATmega328-based boards (Uno, Duemilanove, Diecimila), ESP8266 and ESP32 are currently supported"
 #endif
 
 #ifdef CHAINLINK
-#define MOTOR_BUFFER_LENGTH (NUM_MODULES * 2 / 3 + (NUM_MODULES % 3 != 0) * 2)
-#define SENSOR_BUFFER_LENGTH (NUM_MODULES / 6 + (NUM_MODULES % 6 != 0))
+#define MODULES_PER_DRIVER_BOARD 6
+#define MOTOR_BYTES_PER_DRIVER_BOARD 4
+#define MOTOR_BYTES(modules) ((modules) * 2 / 3 + ((modules) % 3 != 0) * 2)
+#define SENSOR_BYTES(modules) ((modules) / 6 + ((modules) % 6 != 0))
 #else
-#define MOTOR_BUFFER_LENGTH (NUM_MODULES / 2 + (NUM_MODULES % 2 != 0))
-#define SENSOR_BUFFER_LENGTH (NUM_MODULES / 4 + (NUM_MODULES % 4 != 0))
+#define MODULES_PER_DRIVER_BOARD 4
+#define MOTOR_BYTES_PER_DRIVER_BOARD 2
+#define MOTOR_BYTES(modules) ((modules) / 2 + ((modules) % 2 != 0))
+#define SENSOR_BYTES(modules) ((modules) / 4 + ((modules) % 4 != 0))
 #endif
 
+// Chain 0 drives modules [0, SECOND_CHAIN_FIRST_MODULE) and chain 1 the rest, by default splitting them about evenly
+// (on a driver board boundary). Each chain's bytes are contiguous in motor_buffer/sensor_buffer, in chain order.
+#if NUM_IO_CHAINS > 1
+#ifndef ESP32
+#error "Multiple I/O chains are only supported on ESP32"
+#endif
+#if NUM_IO_CHAINS > 2
+#error "At most 2 I/O chains are supported (one per free SPI host)"
+#endif
+#ifndef SECOND_CHAIN_FIRST_MODULE
+#define SECOND_CHAIN_FIRST_MODULE ((NUM_MODULES / 2 + MODULES_PER_DRIVER_BOARD - 1) / MODULES_PER_DRIVER_BOARD * MODULES_PER_DRIVER_BOARD)
+#endif
+#if SECOND_CHAIN_FIRST_MODULE <= 0 || SECOND_CHAIN_FIRST_MODULE >= NUM_MODULES
+#error "SECOND_CHAIN_FIRST_MODULE must leave at least one module on each chain"
+#endif
+#if SECOND_CHAIN_FIRST_MODULE % MODULES_PER_DRIVER_BOARD != 0
+#error "SECOND_CHAIN_FIRST_MODULE must be the first module of a driver board"
+#endif
+#define IO_CHAIN_FIRST_MODULE(chain) ((chain) == 0 ? 0 : (chain) == 1 ? SECOND_CHAIN_FIRST_MODULE : NUM_MODULES)
+#else
+#define IO_CHAIN_FIRST_MODULE(chain) ((chain) == 0 ? 0 : NUM_MODULES)
+#endif
+#define IO_CHAIN_MODULES(chain) (IO_CHAIN_FIRST_MODULE((chain) + 1) - IO_CHAIN_FIRST_MODULE(chain))
+#define IO_CHAIN_MOTOR_LENGTH(chain) MOTOR_BYTES(IO_CHAIN_MODULES(chain))
+#define IO_CHAIN_SENSOR_LENGTH(chain) SENSOR_BYTES(IO_CHAIN_MODULES(chain))
+#define IO_CHAIN_MOTOR_OFFSET(chain) ((chain) == 0 ? 0 : IO_CHAIN_MOTOR_LENGTH(0))
+#define IO_CHAIN_SENSOR_OFFSET(chain) ((chain) == 0 ? 0 : IO_CHAIN_SENSOR_LENGTH(0))
+
+#define MOTOR_BUFFER_LENGTH (IO_CHAIN_MOTOR_OFFSET(NUM_IO_CHAINS - 1) + IO_CHAIN_MOTOR_LENGTH(NUM_IO_CHAINS - 1))
+#define SENSOR_BUFFER_LENGTH (IO_CHAIN_SENSOR_OFFSET(NUM_IO_CHAINS - 1) + IO_CHAIN_SENSOR_LENGTH(NUM_IO_CHAINS - 1))
+
 
 BUFFER_ATTRS uint8_t motor_buffer[MOTOR_BUFFER_LENGTH];
-BUFFER_ATTRS uint8_t sensor_buffer[SENSOR_BUFFER_LENGTH];
+// Padded to whole words for ModuleBank::DecodeSensors(), along with the previous frame's copy it compares against
+#define SENSOR_BUFFER_WORD_LENGTH ((SENSOR_BUFFER_LENGTH + 3) & ~3)
+BUFFER_ATTRS uint8_t sensor_buffer[SENSOR_BUFFER_WORD_LENGTH];
+uint8_t sensor_previous_buffer[SENSOR_BUFFER_WORD_LENGTH];
 
-#ifdef __AVR__
-// Define placement new so we can initialize SplitflapModules at runtime into a static buffer.
-// (see https://arduino.stackexchange.com/a/1499)
-void* operator new(__attribute__((unused)) size_t size, void* ptr) {
-  return ptr;
+#ifdef ESP32
+// What DMA actually transfers, per chain. motor_buffer/sensor_buffer are copied to/from these at frame boundaries, so
+// the next frame can be computed while this one is on the wire. Each chain's buffer is rounded up to whole words for
+// DMA.
+#define IO_CHAIN_MAX_MOTOR_LENGTH (IO_CHAIN_MOTOR_LENGTH(0) > IO_CHAIN_MOTOR_LENGTH(NUM_IO_CHAINS - 1) ? \
+    IO_CHAIN_MOTOR_LENGTH(0) : IO_CHAIN_MOTOR_LENGTH(NUM_IO_CHAINS - 1))
+#define IO_CHAIN_WIRE_LENGTH ((IO_CHAIN_MAX_MOTOR_LENGTH + 3) & ~3)
+BUFFER_ATTRS uint8_t motor_wire_buffer[NUM_IO_CHAINS][IO_CHAIN_WIRE_LENGTH];
+#if FULL_DUPLEX_MOTOR_SENSOR_IO
+// Receives as many bytes as are sent; sensor bytes come first, since the 74HC165s are closest to MISO
+BUFFER_ATTRS uint8_t sensor_wire_buffer[NUM_IO_CHAINS][IO_CHAIN_WIRE_LENGTH];
+#else
+BUFFER_ATTRS uint8_t sensor_wire_buffer[NUM_IO_CHAINS][SENSOR_BUFFER_LENGTH];
+#endif
+#endif
+
+// Which chain drives module i, and how far along it the module is (0 being nearest the controller)
+constexpr uint8_t io_chain_for_module(uint8_t i) {
+  return NUM_IO_CHAINS > 1 && i >= IO_CHAIN_FIRST_MODULE(1) ? 1 : 0;
+}
+constexpr uint8_t io_chain_position(uint8_t i) {
+  return i - IO_CHAIN_FIRST_MODULE(io_chain_for_module(i));
+}
+
+// Index of a chain's motor byte nearest the controller (shifted out last) in motor_buffer, and likewise of its sensor
+// byte (shifted in first) in sensor_buffer
+constexpr uint8_t io_chain_last_motor_byte(uint8_t chain) {
+  return IO_CHAIN_MOTOR_OFFSET(chain) + IO_CHAIN_MOTOR_LENGTH(chain) - 1;
+}
+constexpr uint8_t io_chain_first_sensor_byte(uint8_t chain) {
+  return IO_CHAIN_SENSOR_OFFSET(chain);
+}
+
+#define NUM_DRIVER_BOARDS ((NUM_MODULES + MODULES_PER_DRIVER_BOARD - 1) / MODULES_PER_DRIVER_BOARD)
+
+// Index in motor_buffer of a driver board's motor byte nearest the controller, and how many motor bytes it has (fewer
+// than MOTOR_BYTES_PER_DRIVER_BOARD for a partly used last board). Its other bytes precede that one in motor_buffer.
+constexpr uint8_t io_board_motor_byte(uint8_t board) {
+  return io_chain_last_motor_byte(io_chain_for_module(board * MODULES_PER_DRIVER_BOARD))
+      - io_chain_position(board * MODULES_PER_DRIVER_BOARD) / MODULES_PER_DRIVER_BOARD * MOTOR_BYTES_PER_DRIVER_BOARD;
+}
+constexpr uint8_t io_board_motor_bytes(uint8_t board) {
+  return io_board_motor_byte(board) + 1 - IO_CHAIN_MOTOR_OFFSET(io_chain_for_module(board * MODULES_PER_DRIVER_BOARD))
+      < MOTOR_BYTES_PER_DRIVER_BOARD
+      ? io_board_motor_byte(board) + 1 - IO_CHAIN_MOTOR_OFFSET(io_chain_for_module(board * MODULES_PER_DRIVER_BOARD))
+      : MOTOR_BYTES_PER_DRIVER_BOARD;
 }
+
+// io_board_motor_byte() and io_board_motor_bytes() for every board, generated at compile time
+template <typename Sequence>
+struct MotorPackTable;
+
+template <size_t... B>
+struct MotorPackTable<IndexSequence<B...>> {
+  static const uint8_t FIRST_BYTE[sizeof...(B)];
+  static const uint8_t BYTES[sizeof...(B)];
+};
+
+template <size_t... B>
+const PROGMEM uint8_t MotorPackTable<IndexSequence<B...>>::FIRST_BYTE[sizeof...(B)] = {io_board_motor_byte(B)...};
+
+template <size_t... B>
+const PROGMEM uint8_t MotorPackTable<IndexSequence<B...>>::BYTES[sizeof...(B)] = {io_board_motor_bytes(B)...};
+
+typedef MotorPackTable<MakeIndexSequence<NUM_DRIVER_BOARDS>::type> MotorPack;
+
+// Where each module's 4 motor bits (and on Chainlink, its LED and the board's loopback outputs) go within its board's
+// motor bytes, taken as one word with the byte nearest the controller lowest
+#ifdef CHAINLINK
+typedef uint32_t BoardMotorWord;
+static const uint8_t BOARD_MOTOR_SHIFT[MODULES_PER_DRIVER_BOARD] = {0, 4, 8, 20, 24, 28};
+static const uint8_t BOARD_LED_SHIFT[MODULES_PER_DRIVER_BOARD] = {12, 13, 14, 16, 17, 18};
+static const uint8_t BOARD_LOOPBACK_SHIFT[] = {15, 19};
+#else
+typedef uint16_t BoardMotorWord;
+static const uint8_t BOARD_MOTOR_SHIFT[MODULES_PER_DRIVER_BOARD] = {0, 4, 8, 12};
+#endif
+
+// Outputs for each module, packed into motor_buffer for every frame by pack_motor_buffer(). Each module has a whole
+// byte, so updating one never has to read-modify-write bits that belong to another.
+uint8_t motor_phases[NUM_MODULES];
+#ifdef CHAINLINK
+bool chainlink_leds[NUM_MODULES];
+bool chainlink_loopback_outputs[NUM_LOOPBACKS];
+#endif
+
+// Builds motor_buffer from motor_phases (and Chainlink LEDs and loopbacks) in one pass, a board's word at a time
+inline void pack_motor_buffer() {
+  for (uint8_t board = 0; board < NUM_DRIVER_BOARDS; board++) {
+    uint8_t first = board * MODULES_PER_DRIVER_BOARD;
+    BoardMotorWord word = 0;
+    for (uint8_t p = 0; p < MODULES_PER_DRIVER_BOARD && first + p < NUM_MODULES; p++) {
+      word |= (BoardMotorWord)motor_phases[first + p] << BOARD_MOTOR_SHIFT[p];
+#ifdef CHAINLINK
+      word |= (BoardMotorWord)chainlink_leds[first + p] << BOARD_LED_SHIFT[p];
+#endif
+    }
+#ifdef CHAINLINK
+    for (uint8_t l = 0; l < 2 && board * 2 + l < NUM_LOOPBACKS; l++) {
+      word |= (BoardMotorWord)chainlink_loopback_outputs[board * 2 + l] << BOARD_LOOPBACK_SHIFT[l];
+    }
 #endif
 
+    uint8_t byte = pgm_read_byte_near(MotorPack::FIRST_BYTE + board);
+    uint8_t bytes = pgm_read_byte_near(MotorPack::BYTES + board);
+    for (uint8_t k = 0; k < bytes; k++) {
+      motor_buffer[byte - k] = word;
+      word >>= 8;
+    }
+  }
+}
+
+// Number of I/O frames completed, and (on ESP32) time spent waiting for them, i.e. not overlapped with anything
+// useful, for measuring I/O throughput
+uint32_t motor_sensor_io_frames = 0;
+uint32_t motor_sensor_io_wait_micros = 0;
+
 #ifdef ESP32
+// Transaction callbacks, run from the SPI interrupt since transactions are queued
 void reset_latch(spi_transaction_t *trans) {
     digitalWrite(LATCH_PIN, LOW);
 }
@@ -120,29 +336,59 @@ void reset_latch(spi_transaction_t *trans) {
 void latch_registers(spi_transaction_t *trans) {
     digitalWrite(LATCH_PIN, HIGH);
 }
+
+// With a single full-duplex transaction, the outputs are only complete once it's done, so latch them afterwards and
+// then go back to loading the inputs
+void latch_outputs_and_reset(spi_transaction_t *trans) {
+    digitalWrite(LATCH_PIN, LOW);
+    digitalWrite(LATCH_PIN, HIGH);
+    digitalWrite(LATCH_PIN, LOW);
+}
+
+struct IoChainPins {
+    spi_host_device_t host;
+    int dma_channel;
+    int mosi;
+    int miso;
+    int clk;
+};
+
+static const IoChainPins IO_CHAIN_PINS[NUM_IO_CHAINS] = {
+    {SPI_HOST, DMA_CHANNEL, PIN_NUM_MOSI, PIN_NUM_MISO, PIN_NUM_CLK},
+#if NUM_IO_CHAINS > 1
+    {SECOND_CHAIN_SPI_HOST, SECOND_CHAIN_DMA_CHANNEL, SECOND_CHAIN_PIN_NUM_MOSI, SECOND_CHAIN_PIN_NUM_MISO, SECOND_CHAIN_PIN_NUM_CLK},
+#endif
+};
 #endif
 
-// Static buffer for SplitflapModules (initialized at runtime)
+ModuleBank module_bank;
+
+// Static buffer for SplitflapModule views onto module_bank (initialized at runtime)
 static char moduleBuffer[NUM_MODULES][sizeof(SplitflapModule)];
 
 SplitflapModule* modules[NUM_MODULES];
 
-#ifdef CHAINLINK
-static const uint8_t MOTOR_OFFSET[] = {0, 0, 1, 2, 3, 3};
-#endif
-
 inline void initialize_modules() {
   for (uint8_t i = 0; i < NUM_MODULES; i++) {
     // Create SplitflapModules in a statically allocated buffer using placement new
+    uint8_t chain = io_chain_for_module(i);
+    uint8_t p = io_chain_position(i);
 #ifdef CHAINLINK
-    modules[i] = new (moduleBuffer[i]) SplitflapModule(motor_buffer[MOTOR_BUFFER_LENGTH - 1 - i/6*4 - MOTOR_OFFSET[i%6]], i % 2 == 0 ? 0 : 4, sensor_buffer[i/6], 1 << (i % 6));
+    module_bank.Configure(i, motor_phases[i], 0, sensor_buffer[io_chain_first_sensor_byte(chain) + p/6], 1 << (p % 6));
 #else
-    modules[i] = new (moduleBuffer[i]) SplitflapModule(motor_buffer[MOTOR_BUFFER_LENGTH - 1 - i/2], i % 2 == 0 ? 0 : 4, sensor_buffer[i/4], 1 << (i % 4));
+    module_bank.Configure(i, motor_phases[i], 0, sensor_buffer[io_chain_first_sensor_byte(chain) + p/4], 1 << (p % 4));
 #endif
+    modules[i] = new (moduleBuffer[i]) SplitflapModule(module_bank, i);
   }
   
+  memset(motor_phases, 0, sizeof(motor_phases));
+#ifdef CHAINLINK
+  memset(chainlink_leds, 0, sizeof(chainlink_leds));
+  memset(chainlink_loopback_outputs, 0, sizeof(chainlink_loopback_outputs));
+#endif
   memset(motor_buffer, 0, MOTOR_BUFFER_LENGTH);
-  memset(sensor_buffer, 0, SENSOR_BUFFER_LENGTH);
+  memset(sensor_buffer, 0, SENSOR_BUFFER_WORD_LENGTH);
+  memset(sensor_previous_buffer, 0, SENSOR_BUFFER_WORD_LENGTH);
 
   // Initialize SPI
 #ifdef IN_LATCH_PIN
@@ -164,18 +410,49 @@ inline void initialize_modules() {
 
   esp_err_t ret;
 
-  //Initialize the SPI bus
-  spi_bus_config_t tx_bus_config = {
-      .mosi_io_num = PIN_NUM_MOSI,
-      .miso_io_num = PIN_NUM_MISO,
-      .sclk_io_num = PIN_NUM_CLK,
-      .quadwp_io_num = -1,
-      .quadhd_io_num = -1,
-      .max_transfer_sz = 1000,
-  };
-  ret=spi_bus_initialize(SPI_HOST, &tx_bus_config, DMA_CHANNEL);
-  ESP_ERROR_CHECK(ret);
+  //Initialize the SPI bus for each chain
+  for (uint8_t chain = 0; chain < NUM_IO_CHAINS; chain++) {
+    spi_bus_config_t tx_bus_config = {
+        .mosi_io_num = IO_CHAIN_PINS[chain].mosi,
+        .miso_io_num = IO_CHAIN_PINS[chain].miso,
+        .sclk_io_num = IO_CHAIN_PINS[chain].clk,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = 1000,
+    };
+    ret=spi_bus_initialize(IO_CHAIN_PINS[chain].host, &tx_bus_config, IO_CHAIN_PINS[chain].dma_channel);
+    ESP_ERROR_CHECK(ret);
+  }
 
+#if FULL_DUPLEX_MOTOR_SENSOR_IO
+  // Sensor inputs are captured on the rising edge of the latch before shifting; motor outputs are latched after. With
+  // multiple chains, that's done around the whole frame (see motor_sensor_io_start), not per transaction.
+  spi_device_interface_config_t io_device_config = {
+      .command_bits=0,
+      .address_bits=0,
+      .dummy_bits=0,
+      .mode=0,
+      .duty_cycle_pos=0,
+      .cs_ena_pretrans=0,
+      .cs_ena_posttrans=0,
+      .clock_speed_hz=SPI_CLOCK,
+      .input_delay_ns=0,
+      .spics_io_num=-1,
+      .flags = 0,
+      .queue_size=1,
+      .pre_cb=NUM_IO_CHAINS > 1 ? NULL : &latch_registers,
+      .post_cb=NUM_IO_CHAINS > 1 ? NULL : &latch_outputs_and_reset,
+  };
+  for (uint8_t chain = 0; chain < NUM_IO_CHAINS; chain++) {
+    ret=spi_bus_add_device(IO_CHAIN_PINS[chain].host, &io_device_config, &spi_io[chain]);
+    ESP_ERROR_CHECK(ret);
+
+    memset(&io_transaction[chain], 0, sizeof(io_transaction[chain]));
+    io_transaction[chain].length = IO_CHAIN_MOTOR_LENGTH(chain)*8;
+    io_transaction[chain].tx_buffer = motor_wire_buffer[chain];
+    io_transaction[chain].rx_buffer = sensor_wire_buffer[chain];
+  }
+#else
   spi_device_interface_config_t tx_device_config = {
       .command_bits=0,
       .address_bits=0,
@@ -216,14 +493,15 @@ inline void initialize_modules() {
 
   memset(&tx_transaction, 0, sizeof(tx_transaction));
   tx_transaction.length = MOTOR_BUFFER_LENGTH*8;
-  tx_transaction.tx_buffer = &motor_buffer;
+  tx_transaction.tx_buffer = motor_wire_buffer[0];
   tx_transaction.rx_buffer = NULL;
 
   memset(&rx_transaction, 0, sizeof(rx_transaction));
   rx_transaction.length = SENSOR_BUFFER_LENGTH*8;
   rx_transaction.rxlength = SENSOR_BUFFER_LENGTH*8;
   rx_transaction.tx_buffer = NULL;
-  rx_transaction.rx_buffer = &sensor_buffer;
+  rx_transaction.rx_buffer = sensor_wire_buffer[0];
+#endif
 
 #else
   SPI.begin();
@@ -231,18 +509,84 @@ inline void initialize_modules() {
 #endif
 }
 
-inline void motor_sensor_io() {
+// Passes a frame's home sensor readings on to the modules; each sensor byte holds one driver board's modules
+inline void decode_sensors() {
+  module_bank.DecodeSensors(sensor_buffer, sensor_previous_buffer, SENSOR_BUFFER_LENGTH, MODULES_PER_DRIVER_BOARD);
+}
+
 #ifdef ESP32
+// Queues a frame shifting out the current motor_buffer. With separate transactions, the transmit device was added
+// first, so the driver always runs its transaction (and so latches the new outputs) before the receive. With multiple
+// chains, sensor inputs are captured for all of them here, and outputs latched once they've all finished shifting, in
+// motor_sensor_io_finish() (so when pipelined, a frame's outputs change at the start of the next frame rather than as
+// soon as it's shifted out).
+inline void motor_sensor_io_start() {
     esp_err_t ret;
-    
-    // Send data
-    ret=spi_device_polling_transmit(spi_tx, &tx_transaction);
+    pack_motor_buffer();
+    for (uint8_t chain = 0; chain < NUM_IO_CHAINS; chain++) {
+        memcpy(motor_wire_buffer[chain], motor_buffer + IO_CHAIN_MOTOR_OFFSET(chain), IO_CHAIN_MOTOR_LENGTH(chain));
+    }
+
+#if FULL_DUPLEX_MOTOR_SENSOR_IO
+#if NUM_IO_CHAINS > 1
+    latch_registers(NULL);
+#endif
+    for (uint8_t chain = 0; chain < NUM_IO_CHAINS; chain++) {
+        ret=spi_device_queue_trans(spi_io[chain], &io_transaction[chain], portMAX_DELAY);
+        assert(ret==ESP_OK);
+    }
+#else
+    ret=spi_device_queue_trans(spi_tx, &tx_transaction, portMAX_DELAY);
     assert(ret==ESP_OK);
+    ret=spi_device_queue_trans(spi_rx, &rx_transaction, portMAX_DELAY);
+    assert(ret==ESP_OK);
+#endif
+    motor_sensor_io_in_flight = true;
+}
+
+// Waits for the frame queued by motor_sensor_io_start() (if any) and publishes its sensor readings to sensor_buffer
+inline void motor_sensor_io_finish() {
+    if (!motor_sensor_io_in_flight) {
+        return;
+    }
+
+    esp_err_t ret;
+    spi_transaction_t* result;
+    uint32_t start = micros();
 
-    // Receive data
-    ret=spi_device_polling_transmit(spi_rx, &rx_transaction);
+#if FULL_DUPLEX_MOTOR_SENSOR_IO
+    for (uint8_t chain = 0; chain < NUM_IO_CHAINS; chain++) {
+        ret=spi_device_get_trans_result(spi_io[chain], &result, portMAX_DELAY);
+        assert(ret==ESP_OK);
+    }
+#if NUM_IO_CHAINS > 1
+    latch_outputs_and_reset(NULL);
+#endif
+#else
+    ret=spi_device_get_trans_result(spi_tx, &result, portMAX_DELAY);
     assert(ret==ESP_OK);
+    ret=spi_device_get_trans_result(spi_rx, &result, portMAX_DELAY);
+    assert(ret==ESP_OK);
+#endif
+
+    motor_sensor_io_wait_micros += micros() - start;
+    for (uint8_t chain = 0; chain < NUM_IO_CHAINS; chain++) {
+        memcpy(sensor_buffer + IO_CHAIN_SENSOR_OFFSET(chain), sensor_wire_buffer[chain], IO_CHAIN_SENSOR_LENGTH(chain));
+    }
+    decode_sensors();
+    motor_sensor_io_in_flight = false;
+    motor_sensor_io_frames++;
+}
+#endif
+
+// Shifts out motor_buffer and reads sensor_buffer, returning once both are done
+inline void motor_sensor_io() {
+#ifdef ESP32
+    motor_sensor_io_finish();
+    motor_sensor_io_start();
+    motor_sensor_io_finish();
 #else
+  pack_motor_buffer();
   IN_LATCH();
   delayMicroseconds(1);
 
@@ -267,29 +611,45 @@ inline void motor_sensor_io() {
   }
 
   OUT_LATCH();
+  decode_sensors();
+  motor_sensor_io_frames++;
+#endif
+}
+
+/**
+ * Like motor_sensor_io(), but only waits for the previous frame and queues this one, so the caller can get on with
+ * the next update while it's on the wire. Sensor readings are therefore a frame older: on return, sensor_buffer is
+ * from the previous call's frame. Where I/O can't run in the background, this is just motor_sensor_io().
+ */
+inline void motor_sensor_io_pipelined() {
+#if defined(ESP32) && ASYNC_MOTOR_SENSOR_IO
+    motor_sensor_io_finish();
+    motor_sensor_io_start();
+#else
+    motor_sensor_io();
 #endif
 }
 
 #ifdef CHAINLINK
+// Each Chainlink Driver board has 6 modules and 2 loopbacks
+#define CHAINLINK_MODULES_PER_BOARD 6
+#define CHAINLINK_LOOPBACKS_PER_BOARD 2
+
+// Number of loopback inputs that are checked, i.e. those on boards that are actually connected (see
+// chainlink_count_boards)
+uint8_t chainlink_num_loopbacks = NUM_LOOPBACKS;
+
 void chainlink_set_led(uint8_t moduleIndex, bool on) {
-  uint8_t groupPosition = moduleIndex % 6;
-  uint8_t byteIndex = MOTOR_BUFFER_LENGTH - 1 - moduleIndex/6*4 - (groupPosition < 3 ? 1 : 2);
-  uint8_t bitMask = (groupPosition < 3) ? (1 << (4 + groupPosition)) : (1 << (groupPosition - 3));
-  if (on) {
-    motor_buffer[byteIndex] |= bitMask;
-  } else {
-    motor_buffer[byteIndex] &= ~bitMask;
-  }
+  chainlink_leds[moduleIndex] = on;
 }
 
-static uint8_t chainlink_loopbackMotorByte(uint8_t loopbackIndex) {
-  return MOTOR_BUFFER_LENGTH - 1 - (loopbackIndex / 2) * 4 - (((loopbackIndex % 2) == 0) ? 1 : 2);
-}
-static uint8_t chainlink_loopbackMotorBitMask(uint8_t loopbackIndex) {
-  return (loopbackIndex % 2) == 0 ? (1 << 7) : (1 << 3);
+// Loopbacks are numbered along the chain(s) like modules, two per board
+static uint8_t chainlink_loopbackModule(uint8_t loopbackIndex) {
+  return loopbackIndex / 2 * 6;
 }
 static uint8_t chainlink_loopbackSensorByte(uint8_t loopbackIndex) {
-  return loopbackIndex / 2;
+  uint8_t module = chainlink_loopbackModule(loopbackIndex);
+  return io_chain_first_sensor_byte(io_chain_for_module(module)) + io_chain_position(module) / 6;
 }
 static uint8_t chainlink_loopbackSensorBitMask(uint8_t loopbackIndex) {
   return (loopbackIndex % 2) == 0 ? 1 << 6 : 1 << 7;
@@ -299,11 +659,13 @@ bool chainlink_test_startup_loopback(bool results[NUM_LOOPBACKS]) {
     bool success = true;
 
     // Turn off all motors, leds, and loopbacks; make sure all loopback inputs read 0
-    memset(motor_buffer, 0, MOTOR_BUFFER_LENGTH);
+    memset(motor_phases, 0, sizeof(motor_phases));
+    memset(chainlink_leds, 0, sizeof(chainlink_leds));
+    memset(chainlink_loopback_outputs, 0, sizeof(chainlink_loopback_outputs));
     motor_sensor_io();
     motor_sensor_io();
 
-    for (uint8_t i = 0; i < NUM_LOOPBACKS; i++) {
+    for (uint8_t i = 0; i < chainlink_num_loopbacks; i++) {
       results[i] = ((sensor_buffer[chainlink_loopbackSensorByte(i)] & chainlink_loopbackSensorBitMask(i))) == 0;
       success &= results[i];
     }
@@ -312,17 +674,17 @@ bool chainlink_test_startup_loopback(bool results[NUM_LOOPBACKS]) {
 
 void chainlink_set_loopback(uint8_t loop_out_index) {
     // Turn on loopback output
-    motor_buffer[chainlink_loopbackMotorByte(loop_out_index)] |= chainlink_loopbackMotorBitMask(loop_out_index);
+    chainlink_loopback_outputs[loop_out_index] = true;
 }
 
 /**
  * Validate that the loopback from loop_out_index can be read successfully. There must be AT LEAST 2 motor_sensor_io() invocations
  * between setting the loopback and validating it - one for turning on the shift register output and another to read in the shift
- * register input.
+ * register input. motor_sensor_io_pipelined() adds a frame of latency, so it needs 3.
  */
 bool chainlink_validate_loopback(uint8_t loop_out_index, bool results[NUM_LOOPBACKS]) {
     bool success = true;
-    for (uint8_t loop_in_index = 0; loop_in_index < NUM_LOOPBACKS; loop_in_index++) {
+    for (uint8_t loop_in_index = 0; loop_in_index < chainlink_num_loopbacks; loop_in_index++) {
       uint8_t expected_bit_mask = (loop_out_index == loop_in_index) ? chainlink_loopbackSensorBitMask(loop_in_index) : 0;
       uint8_t actual_bit_mask = sensor_buffer[chainlink_loopbackSensorByte(loop_in_index)] & chainlink_loopbackSensorBitMask(loop_in_index);
 
@@ -334,7 +696,7 @@ bool chainlink_validate_loopback(uint8_t loop_out_index, bool results[NUM_LOOPBA
     }
 
     // Turn off loopback output
-    motor_buffer[chainlink_loopbackMotorByte(loop_out_index)] &= ~chainlink_loopbackMotorBitMask(loop_out_index);
+    chainlink_loopback_outputs[loop_out_index] = false;
     return success;
 }
 
@@ -354,6 +716,72 @@ bool chainlink_test_all_loopbacks(bool loopback_result[NUM_LOOPBACKS][NUM_LOOPBA
     return loopback_success;
 }
 
+/**
+ * Binary-coded loopback patterns, which check every loopback at once rather than one at a time. Pattern p drives each
+ * loopback output with bit p/2 of its own index, inverted for odd p. Across all patterns, every loopback is seen both
+ * set and cleared (catching stuck inputs and outputs), and any two loopbacks differ in at least one pattern (catching
+ * shorts between them), in 2 * ceil(log2(loopbacks)) patterns.
+ */
+uint8_t chainlink_loopback_pattern_count() {
+    uint8_t bits = 1;
+    while ((1 << bits) < chainlink_num_loopbacks) {
+      bits++;
+    }
+    return bits * 2;
+}
+
+static bool chainlink_loopback_pattern_bit(uint8_t pattern, uint8_t loopbackIndex) {
+    return (((loopbackIndex >> (pattern / 2)) & 1) != 0) != (pattern % 2 != 0);
+}
+
+void chainlink_set_loopback_pattern(uint8_t pattern) {
+    for (uint8_t i = 0; i < chainlink_num_loopbacks; i++) {
+      chainlink_loopback_outputs[i] = chainlink_loopback_pattern_bit(pattern, i);
+    }
+}
+
+/**
+ * Validate that every loopback input reads back the pattern set by chainlink_set_loopback_pattern(). As with
+ * chainlink_validate_loopback(), the pattern must have had time to come back through the shift registers.
+ */
+bool chainlink_validate_loopback_pattern(uint8_t pattern) {
+    bool success = true;
+    for (uint8_t i = 0; i < chainlink_num_loopbacks; i++) {
+      bool actual = (sensor_buffer[chainlink_loopbackSensorByte(i)] & chainlink_loopbackSensorBitMask(i)) != 0;
+      success &= actual == chainlink_loopback_pattern_bit(pattern, i);
+    }
+    return success;
+}
+
+/**
+ * Counts the driver boards connected, from the results of chainlink_test_all_loopbacks() over the full NUM_LOOPBACKS.
+ * Data for boards past the end of the chain falls off it, and their inputs read whatever the end of the chain is tied
+ * to, so a board is only present if each of its loopbacks reads back when set and reads 0 when cleared. Boards are
+ * counted from the start of the chain (nearest the controller) up to the first one missing.
+ *
+ * Returns false if a board appears to be present after a missing one, which means a board in the middle of the chain
+ * has a broken loopback rather than the chain being short.
+ */
+bool chainlink_count_boards(bool loopback_result[NUM_LOOPBACKS][NUM_LOOPBACKS], bool loopback_off_result[NUM_LOOPBACKS], uint8_t* boards) {
+    *boards = 0;
+    bool missing = false;
+    for (uint8_t board = 0; board * CHAINLINK_LOOPBACKS_PER_BOARD < NUM_LOOPBACKS; board++) {
+      bool present = true;
+      for (uint8_t i = board * CHAINLINK_LOOPBACKS_PER_BOARD; i < (board + 1) * CHAINLINK_LOOPBACKS_PER_BOARD && i < NUM_LOOPBACKS; i++) {
+        present &= loopback_result[i][i] && loopback_off_result[i];
+      }
+
+      if (!present) {
+        missing = true;
+      } else if (missing) {
+        return false;
+      } else {
+        *boards = board + 1;
+      }
+    }
+    return true;
+}
+
 #endif
 
 #endif
@@ -0,0 +1,1240 @@
+/*
+   Copyright 2020 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef SPLITFLAP_MODULE_BANK_H
+#define SPLITFLAP_MODULE_BANK_H
+
+#include <Arduino.h>
+
+#include "acceleration.h"
+#include "spool.h"
+#include "splitflap_module_data.h"
+#include "../config.h"
+
+// Logging and assertions are useful for debugging, but likely add too much time/space overhead to be used when
+// driving many SplitflapModules at once.
+#define VERBOSE_LOGGING false
+#define ASSERTIONS_ENABLED false
+
+#define FAKE_HOME_SENSOR false
+
+#define MOT_PHASE_A B00001000
+#define MOT_PHASE_B B00000100
+#define MOT_PHASE_C B00000010
+#define MOT_PHASE_D B00000001
+
+#if HALF_STEP
+// Alternates between two coils and one, so each step is half a full step
+const uint8_t step_pattern[] = {
+#if REVERSE_MOTOR_DIRECTION
+  MOT_PHASE_D | MOT_PHASE_A,
+  MOT_PHASE_D,
+  MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_C,
+  MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_B,
+  MOT_PHASE_A | MOT_PHASE_B,
+  MOT_PHASE_A,
+#else
+  MOT_PHASE_A | MOT_PHASE_B,
+  MOT_PHASE_B,
+  MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_C,
+  MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_D,
+  MOT_PHASE_D | MOT_PHASE_A,
+  MOT_PHASE_A,
+#endif
+};
+#else
+const uint8_t step_pattern[] = {
+#if REVERSE_MOTOR_DIRECTION
+  MOT_PHASE_D | MOT_PHASE_A,
+  MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_A | MOT_PHASE_B,
+#else
+  MOT_PHASE_A | MOT_PHASE_B,
+  MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_D | MOT_PHASE_A,
+#endif
+};
+#endif
+
+/**
+ * Motion control state for N splitflap modules, stored as parallel arrays (structure-of-arrays) so that Update() can
+ * step every module in one tight pass from a single shared timestamp.
+ *
+ * Each module is identified by its index; SplitflapModule (see splitflap_module.h) provides the original per-object
+ * API as a lightweight view onto a single index.
+ */
+template <uint8_t N>
+class SplitflapModuleBank {
+ private:
+  // Configuration:
+  uint8_t* motor_out[N];
+  uint8_t motor_bitshift[N];
+
+  uint8_t* sensor_in[N];
+  uint8_t sensor_bitmask[N];
+
+  // State:
+  // Home sensor level as of the last ReadSensors()/DecodeSensors(), and whether it has risen since the module last
+  // checked (see CheckSensor)
+  bool home_level[N];
+  bool home_edge[N];
+  unsigned long last_update_micros[N];
+
+  // Tracks the most recent target flap index. Not used during motion, but needed to recalculate target step if we
+  // re-calibrate the home position
+  uint8_t target_flap_index[N];
+
+  // Ring buffer of targets to go to after target_flap_index, each once the previous one has been shown for dwell_millis
+  uint8_t target_queue[N][TARGET_QUEUE_LENGTH];
+  uint8_t target_queue_head[N];
+  uint8_t target_queue_count[N];
+  uint16_t dwell_millis[N];
+  unsigned long stopped_micros[N];
+
+  // Spool::Variant describing this module's flaps and gearing
+  uint8_t spool_variant[N];
+
+  // Current position/destination. Numbers are modulo the spool's input_steps
+  uint32_t current_step[N];
+  uint32_t delta_steps[N];
+
+#if HOME_CALIBRATION_ENABLED
+  // Home calibration state. All values recalculated whenever we see a home sensor blip
+  HomeState home_state[N];
+  uint32_t unexpected_home_start_step[N];  // Start of range where a home sensor blip is unexpected
+  uint32_t unexpected_home_end_step[N];  // End of range where a home sensor blip is unexpected
+
+  // Expected home position step plus some margin of error. If we get to this step without having seen a home
+  // sensor blip, something is wrong and we need to recalibrate.
+  uint32_t missed_home_step[N];
+
+  // Where the next home blip should be, allowing for the learned offset
+  uint32_t expected_home_step[N];
+
+  // Learned home sensor behavior; see UpdateHomeCalibration()
+  HomeCalibration home_calibration[N];
+  bool first_home_since_homing[N];
+  uint16_t home_calibration_generation;
+
+  // While looking for home: the last home_search_slow_steps of delta_steps are searched at low speed (the rest is a
+  // full speed approach to where home is predicted to be). If home_search_fallback is set and the search runs out,
+  // fall back to a full slow search rather than giving up.
+  uint16_t home_search_slow_steps[N];
+  bool home_search_fallback[N];
+  bool fast_rehome;
+
+#if HOME_ERROR_TELEMETRY_ENABLED
+  // Only updated on home blips and recoveries, never per step; see GetHomeErrorTelemetry()
+  HomeErrorTelemetry home_error_telemetry[N];
+  uint16_t home_error_telemetry_generation;
+#endif
+#endif
+
+  // Motor state
+  uint8_t current_phase[N];
+  uint16_t current_period[N];
+
+  // Acceleration::Profile requested for future moves, and the one the current ramp is using
+  uint8_t motion_profile[N];
+  uint8_t active_profile[N];
+
+  void Panic(uint8_t i, String message);
+  bool CheckSensor(uint8_t i);
+  void SetHomeSensor(uint8_t i, bool home);
+  void SetMotor(uint8_t i, uint8_t out);
+
+  uint8_t GetFlapFloor(uint8_t i, uint32_t step);
+  uint32_t GetTargetStepForFlapIndex(uint8_t i, uint32_t from_step, uint8_t target_flap_index);
+  void GoToTargetFlapIndex(uint8_t i);
+  void GoToQueuedFlapIndex(uint8_t i, unsigned long now);
+  void UpdateExpectedHome(uint8_t i);
+#if HOME_CALIBRATION_ENABLED
+  void UpdateHomeCalibration(uint8_t i);
+  uint16_t GetHomeWindowSteps(uint8_t i);
+  void GoToPredictedHome(uint8_t i);
+  void GoToMissedHome(uint8_t i);
+  uint8_t GetHomeSearchAccelStep(uint8_t i);
+  static int16_t RoundHomeCalibration(int16_t value);
+#if HOME_ERROR_TELEMETRY_ENABLED
+  void RecordHomeError(uint8_t i, int16_t error);
+  void RecordRecovery(uint8_t i);
+#endif
+#endif
+
+ public:
+  SplitflapModuleBank();
+
+  // Wires module i to its motor output (4 bits starting at motor_bitshift) and home sensor input
+  void Configure(uint8_t i, uint8_t &motor_out, const uint8_t motor_bitshift, uint8_t &sensor_in, const uint8_t sensor_bitmask);
+
+  // Latches home sensor levels and rising edges after each I/O frame, for modules to pick up when they next step. Either
+  // read each module's configured sensor_in, or decode a whole buffer in which byte j holds the sensors of modules
+  // j * modules_per_byte onwards, in its low bits (see DecodeSensors for details).
+  void ReadSensors();
+  void DecodeSensors(const uint8_t* current, uint8_t* previous, uint8_t length, uint8_t modules_per_byte);
+
+  State state[N];
+  uint8_t current_accel_step[N];
+
+  void GoToFlapIndex(uint8_t i, uint8_t index);
+  bool QueueFlapIndex(uint8_t i, uint8_t index);
+  void ClearQueuedFlapIndices(uint8_t i);
+  uint8_t GetQueuedFlapCount(uint8_t i);
+  void SetDwellMillis(uint8_t i, uint16_t dwell_millis);
+  uint8_t GetCurrentFlapIndex(uint8_t i);
+  uint8_t GetTargetFlapIndex(uint8_t i);
+  void GoHome(uint8_t i);
+  void ResetErrorCounters(uint8_t i);
+  void ResetState(uint8_t i);
+  void SetMotionProfile(uint8_t i, uint8_t profile);
+  uint8_t GetMotionProfile(uint8_t i);
+  void SetSpool(uint8_t i, uint8_t variant);
+  uint8_t GetSpool(uint8_t i);
+  uint8_t GetNumFlaps(uint8_t i);
+  uint32_t GetCurrentStep(uint8_t i);
+  bool RestorePosition(uint8_t i, uint32_t step, uint8_t target_flap_index);
+#if HOME_CALIBRATION_ENABLED
+  const HomeCalibration &GetHomeCalibration(uint8_t i);
+  void SetHomeCalibration(uint8_t i, const HomeCalibration &calibration);
+  uint16_t GetHomeCalibrationGeneration();
+  void SetFastRehome(bool enabled);
+#if HOME_ERROR_TELEMETRY_ENABLED
+  const HomeErrorTelemetry &GetHomeErrorTelemetry(uint8_t i);
+  uint16_t GetHomeErrorTelemetryGeneration();
+#endif
+#endif
+  inline void Update();
+  inline void UpdateModule(uint8_t i, unsigned long now);
+  inline void StepModule(uint8_t i, unsigned long now);
+  inline unsigned long GetNextStepMicros(uint8_t i);
+  inline uint16_t GetStepPeriod(uint8_t i);
+  inline bool IsParked(uint8_t i);
+  inline bool IsAccelerating(uint8_t i);
+  void Init(uint8_t i);
+  bool GetHomeState(uint8_t i);
+  void Disable(uint8_t i);
+
+  uint8_t count_unexpected_home[N];
+  uint8_t count_missed_home[N];
+};
+
+template <uint8_t N>
+SplitflapModuleBank<N>::SplitflapModuleBank() {
+#if HOME_CALIBRATION_ENABLED
+  home_calibration_generation = 0;
+  fast_rehome = true;
+#if HOME_ERROR_TELEMETRY_ENABLED
+  home_error_telemetry_generation = 0;
+#endif
+#endif
+  for (uint8_t i = 0; i < N; i++) {
+    motor_out[i] = nullptr;
+    motor_bitshift[i] = 0;
+    sensor_in[i] = nullptr;
+    sensor_bitmask[i] = 0;
+
+    home_level[i] = false;
+    home_edge[i] = false;
+    last_update_micros[i] = 0;
+    target_flap_index[i] = 0;
+    target_queue_head[i] = 0;
+    target_queue_count[i] = 0;
+    dwell_millis[i] = 0;
+    stopped_micros[i] = 0;
+    spool_variant[i] = Spool::SPOOL_DEFAULT;
+    current_step[i] = 0;
+    delta_steps[i] = 0;
+#if HOME_CALIBRATION_ENABLED
+    home_state[i] = IGNORE;
+    unexpected_home_start_step[i] = 0;
+    unexpected_home_end_step[i] = 0;
+    missed_home_step[i] = 0;
+    expected_home_step[i] = 0;
+    home_calibration[i] = {0, 0, 0};
+    first_home_since_homing[i] = false;
+    home_search_slow_steps[i] = 0;
+    home_search_fallback[i] = false;
+#if HOME_ERROR_TELEMETRY_ENABLED
+    home_error_telemetry[i] = {};
+#endif
+    state[i] = SENSOR_ERROR; // Start in SENSOR_ERROR state until initialized
+#else
+    state[i] = NORMAL;
+#endif
+    current_phase[i] = 0;
+    current_period[i] = pgm_read_word_near(Acceleration::ACCEL_STEP_PERIODS);
+    motion_profile[i] = Acceleration::PROFILE_DEFAULT;
+    active_profile[i] = Acceleration::PROFILE_DEFAULT;
+    current_accel_step[i] = 0;
+    count_unexpected_home[i] = 0;
+    count_missed_home[i] = 0;
+  }
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::Configure(
+  uint8_t i,
+  uint8_t &motor_out,
+  const uint8_t motor_bitshift,
+  uint8_t &sensor_in,
+  const uint8_t sensor_bitmask) {
+    this->motor_out[i] = &motor_out;
+    this->motor_bitshift[i] = motor_bitshift;
+    this->sensor_in[i] = &sensor_in;
+    this->sensor_bitmask[i] = sensor_bitmask;
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::Disable(uint8_t i) {
+  SetMotor(i, 0);
+  state[i] = STATE_DISABLED;
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::Panic(uint8_t i, String message) {
+  SetMotor(i, 0);
+  state[i] = PANIC;
+  Serial.print("#### PANIC! ####\n");
+  Serial.print(message);
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline bool SplitflapModuleBank<N>::CheckSensor(uint8_t i) {
+    bool shift = home_edge[i];
+    home_edge[i] = false;
+    return shift;
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::SetHomeSensor(uint8_t i, bool home) {
+    home_edge[i] |= home && !home_level[i];
+    home_level[i] = home;
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::ReadSensors() {
+    for (uint8_t i = 0; i < N; i++) {
+        if (sensor_in[i] != nullptr) {
+            SetHomeSensor(i, (*sensor_in[i] & sensor_bitmask[i]) != 0);
+        }
+    }
+}
+
+/**
+ * Updates home sensor levels and edges from a frame's sensor bytes, where byte j holds modules j * modules_per_byte
+ * onwards in its low bits (and anything else, e.g. Chainlink loopbacks, above them). previous holds the bytes as of the
+ * last call, and is updated. Both must be readable in whole words, i.e. padded to a multiple of 4 bytes.
+ *
+ * On most frames no home sensor changes, so this compares a word (several driver boards) at a time, and only decodes
+ * modules in bytes that changed, rather than every module checking its own bit.
+ */
+template <uint8_t N>
+void SplitflapModuleBank<N>::DecodeSensors(const uint8_t* current, uint8_t* previous, uint8_t length, uint8_t modules_per_byte) {
+    const uint8_t mask = (1 << modules_per_byte) - 1;
+    for (uint8_t w = 0; w < length; w += 4) {
+        uint32_t now, before;
+        memcpy(&now, current + w, 4);
+        memcpy(&before, previous + w, 4);
+        if (now == before) {
+            continue;
+        }
+        memcpy(previous + w, &now, 4);
+
+        uint8_t was[4];
+        memcpy(was, &before, 4);
+        for (uint8_t k = 0; k < 4 && w + k < length; k++) {
+            uint8_t changed = (current[w + k] ^ was[k]) & mask;
+            uint8_t first = (w + k) * modules_per_byte;
+            for (uint8_t b = 0; changed != 0; b++, changed >>= 1) {
+                if ((changed & 1) && first + b < N) {
+                    SetHomeSensor(first + b, (current[w + k] >> b) & 1);
+                }
+            }
+        }
+    }
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::SetMotor(uint8_t i, uint8_t out) {
+  *motor_out[i] = (*motor_out[i] & ~(0x0F << motor_bitshift[i])) | ((out & 0x0F) << motor_bitshift[i]);
+}
+
+/**
+ * Flap position (counting on past the spool's num_flaps into later revolutions) showing at the given step, which must be
+ * less than input_steps. Table-driven: buckets are no wider than a flap, so the bucket's first flap is at most one short.
+ */
+template <uint8_t N>
+__attribute__((always_inline))
+inline uint8_t SplitflapModuleBank<N>::GetFlapFloor(uint8_t i, uint32_t step) {
+    const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+    uint8_t flap = pgm_read_byte_near(spool.bucket_flap + (step >> spool.bucket_shift));
+    if (step >= pgm_read_word_near(spool.flap_start + flap + 1)) {
+        flap++;
+    }
+    return flap;
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline uint32_t SplitflapModuleBank<N>::GetTargetStepForFlapIndex(uint8_t i, uint32_t from_step, uint8_t target_flap_index) {
+    const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+
+#if ASSERTIONS_ENABLED
+    //assert 0 <= from_step < input_steps
+    if (from_step >= spool.input_steps) {
+        Panic(i, "from_step >= input_steps");
+    }
+#endif
+
+    uint8_t from_flap = GetFlapFloor(i, from_step);
+
+    uint8_t from_flap_index = from_flap;
+    while (from_flap_index >= spool.num_flaps) {
+        from_flap_index -= spool.num_flaps;
+    }
+
+    uint8_t delta_flaps;
+    if (target_flap_index > from_flap_index) {
+        delta_flaps = target_flap_index - from_flap_index;
+    } else {
+        // Even if we're exactly at the target flap index, still do a full revolution to get to the target flap
+        // since we're working with rounded numbers
+        delta_flaps = spool.num_flaps + target_flap_index - from_flap_index;
+    }
+
+#if VERBOSE_LOGGING
+    Serial.print("VERBOSE: DELTA FLAPS=");
+    Serial.print(delta_flaps);
+    Serial.print('\n');
+#endif
+
+#if ASSERTIONS_ENABLED
+    //assert 0 < delta_flaps <= num_flaps
+    if (delta_flaps == 0 || delta_flaps > spool.num_flaps) {
+        Panic(i, "delta_flaps == 0 || delta_flaps > num_flaps");
+    }
+#endif
+
+    // The table rounds UP so that the inverse calculation on the result (GetFlapFloor) returns the expected result.
+    return pgm_read_word_near(spool.flap_start + from_flap + delta_flaps);
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::GoToTargetFlapIndex(uint8_t i) {
+    if (state[i] != NORMAL) {
+        return;
+    }
+    delta_steps[i] = GetTargetStepForFlapIndex(i, current_step[i], target_flap_index[i]) - current_step[i];
+    // A moving module sheds one accel step per step, so if it's too close to the target to stop there (e.g. having just
+    // found home at speed), go round again rather than overshoot
+    if (delta_steps[i] < current_accel_step[i]) {
+        const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+        delta_steps[i] += pgm_read_word_near(spool.flap_start + spool.num_flaps);
+    }
+
+
+#if VERBOSE_LOGGING
+    Serial.print("Going to flap index ");
+    Serial.print(target_flap_index[i]);
+    Serial.print(". Current step is ");
+    Serial.print(current_step[i]);
+    Serial.print(". Delta is ");
+    Serial.print(delta_steps[i]);
+    Serial.print('\n');
+#endif
+
+#if ASSERTIONS_ENABLED
+    if (delta_steps[i] > Spool::VARIANTS[spool_variant[i]].input_steps) {
+        Panic(i, "delta_steps > input_steps");
+    }
+#endif
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::UpdateExpectedHome(uint8_t i) {
+#if HOME_CALIBRATION_ENABLED
+    // Expected home position is the next 0 index flap position after the missed_home_step. This must be calculated
+    // from the missed_home_step, rather than current_step, so that in the event of an early home, we don't compute
+    // the next home as the one that is just a few steps away.
+
+    const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+    uint32_t expected_home = GetTargetStepForFlapIndex(i, missed_home_step[i], 0) +
+        RoundHomeCalibration(home_calibration[i].offset);
+    uint16_t window = GetHomeWindowSteps(i);
+
+    uint32_t new_unexpected_home_start_step = current_step[i] + spool.unexpected_home_start_buffer_steps;
+    uint32_t new_unexpected_home_end_step = expected_home - window;
+    uint32_t new_missed_home_step = expected_home + window;
+
+#if VERBOSE_LOGGING
+    Serial.print("Calculated new expected home ");
+    Serial.print(expected_home);
+    Serial.print(".\nOLD:us=");
+    Serial.print(unexpected_home_start_step[i]);
+    Serial.print(", ue=");
+    Serial.print(unexpected_home_end_step[i]);
+    Serial.print(", m=");
+    Serial.print(missed_home_step[i]);
+    Serial.print("\nNEW:us=");
+    Serial.print(new_unexpected_home_start_step);
+    Serial.print(", ue=");
+    Serial.print(new_unexpected_home_end_step);
+    Serial.print(", m=");
+    Serial.print(new_missed_home_step);
+    Serial.print('\n');
+#endif
+
+#if ASSERTIONS_ENABLED
+    // Values shouldn't be more than 2*input_steps, so use subtraction to bound to input_steps rather than using `%`
+    // which may be more expensive
+    //assert 0 <= new_unexpected_home_start_step < 2*input_steps
+    if (new_unexpected_home_start_step >= 2 * (uint32_t)spool.input_steps) {
+        Panic(i, "new_unexpected_home_start_step >= 2 * input_steps");
+    }
+    //assert 0 <= new_unexpected_home_end_step < 2*input_steps
+    if (new_unexpected_home_end_step >= 2 * (uint32_t)spool.input_steps) {
+        Panic(i, "new_unexpected_home_end_step >= 2 * input_steps");
+    }
+    //assert 0 <= new_missed_home_step < 2*input_steps
+    if (new_missed_home_step >= 2 * (uint32_t)spool.input_steps) {
+        Panic(i, "new_missed_home_step >= 2 * input_steps");
+    }
+#endif
+
+    if (new_unexpected_home_start_step >= spool.input_steps) {
+        new_unexpected_home_start_step -= spool.input_steps;
+    }
+    if (new_unexpected_home_end_step >= spool.input_steps) {
+        new_unexpected_home_end_step -= spool.input_steps;
+    }
+    if (new_missed_home_step >= spool.input_steps) {
+        new_missed_home_step -= spool.input_steps;
+    }
+    if (expected_home >= spool.input_steps) {
+        expected_home -= spool.input_steps;
+    }
+
+#if ASSERTIONS_ENABLED
+    // The "unexpected" range should never wrap around, since input_steps represents an integer number of FULL
+    // revolutions.
+    //assert new_unexpected_home_end_step > new_unexpected_home_start_step
+    if (new_unexpected_home_end_step <= new_unexpected_home_start_step) {
+        Panic(i, "new_unexpected_home_end_step <= new_unexpected_home_start_step");
+    }
+#endif
+
+    unexpected_home_start_step[i] = new_unexpected_home_start_step;
+    unexpected_home_end_step[i] = new_unexpected_home_end_step;
+    missed_home_step[i] = new_missed_home_step;
+    expected_home_step[i] = expected_home;
+    home_state[i] = IGNORE;
+#endif
+}
+
+#if HOME_CALIBRATION_ENABLED
+/**
+ * Learns from a home blip seen within the expected window, and corrects the module's position to match it.
+ *
+ * The first blip seen at full speed after homing measures the offset between where home is seen at speed and where
+ * homing found it (e.g. from sensor latency), which moves the expected window rather than the module. Any later error is
+ * lost (or gained) steps: the position is corrected on the spot, and tracked as drift. The window widens to accommodate
+ * modules that drift or whose sensor is noisy, so that only errors beyond what a module usually sees force a full
+ * re-home.
+ */
+template <uint8_t N>
+void SplitflapModuleBank<N>::UpdateHomeCalibration(uint8_t i) {
+    const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+    HomeCalibration &calibration = home_calibration[i];
+
+    int16_t error = (int32_t)current_step[i] - (int32_t)expected_home_step[i];
+    if (error > (int16_t)(spool.input_steps / 2)) {
+        error -= spool.input_steps;
+    } else if (error < -(int16_t)(spool.input_steps / 2)) {
+        error += spool.input_steps;
+    }
+
+    // Everything below is in 1/HOME_CALIBRATION_SCALE steps, with exponentially weighted averages (weight 1/8)
+    int16_t limit = spool.home_error_margin_steps * HOME_CALIBRATION_SCALE;
+    int16_t scaled_error = error * HOME_CALIBRATION_SCALE;
+    if (first_home_since_homing[i]) {
+        // The module can't have lost steps since homing set its position, so there's nothing to correct. Seen at full
+        // speed, the error measures the offset in full (relative to the old offset the expected window was placed with).
+        if (current_accel_step[i] < Acceleration::PROFILES[active_profile[i]].max_accel_step) {
+            return;
+        }
+        first_home_since_homing[i] = false;
+        calibration.offset = constrain(RoundHomeCalibration(calibration.offset) * HOME_CALIBRATION_SCALE + scaled_error, -limit, limit);
+        home_calibration_generation++;
+        return;
+    }
+    calibration.drift = constrain(calibration.drift + (scaled_error - calibration.drift) / 8, -limit, limit);
+    calibration.deviation = constrain(calibration.deviation + (abs(scaled_error - calibration.drift) - calibration.deviation) / 8, 0, limit);
+    home_calibration_generation++;
+#if HOME_ERROR_TELEMETRY_ENABLED
+    RecordHomeError(i, error);
+#endif
+
+    // Expected home already allows for the offset, so all of the error is lost/gained steps
+    int16_t correction = error;
+    if (correction > 0) {
+        current_step[i] = current_step[i] >= (uint32_t)correction ? current_step[i] - correction : current_step[i] + spool.input_steps - correction;
+        delta_steps[i] += correction;
+    } else if (correction < 0) {
+        current_step[i] -= correction;
+        if (current_step[i] >= spool.input_steps) {
+            current_step[i] -= spool.input_steps;
+        }
+        delta_steps[i] = delta_steps[i] > (uint32_t)-correction ? delta_steps[i] + correction : 0;
+    }
+
+#if VERBOSE_LOGGING
+    Serial.print("VERBOSE: Home error ");
+    Serial.print(error);
+    Serial.print(", corrected by ");
+    Serial.print(correction);
+    Serial.print('\n');
+#endif
+}
+
+#if HOME_ERROR_TELEMETRY_ENABLED
+template <uint8_t N>
+void SplitflapModuleBank<N>::RecordHomeError(uint8_t i, int16_t error) {
+    uint16_t magnitude = abs(error);
+    uint8_t distance = magnitude == 0 ? 0 : magnitude <= 2 ? 1 : magnitude <= 6 ? 2 : 3;
+    uint8_t bin = error < 0 ? 3 - distance : 3 + distance;
+
+    uint16_t &count = home_error_telemetry[i].histogram[bin];
+    if (count < UINT16_MAX) {
+        count++;
+    }
+    home_error_telemetry_generation++;
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::RecordRecovery(uint8_t i) {
+    home_error_telemetry[i].recoveries++;
+    home_error_telemetry[i].last_error_millis = millis();
+    home_error_telemetry_generation++;
+}
+#endif
+
+// Half-width of the window around the expected home step in which a home blip is accepted
+template <uint8_t N>
+__attribute__((always_inline))
+inline uint16_t SplitflapModuleBank<N>::GetHomeWindowSteps(uint8_t i) {
+    uint16_t margin = Spool::VARIANTS[spool_variant[i]].home_error_margin_steps;
+    const HomeCalibration &calibration = home_calibration[i];
+    uint16_t learned = RoundHomeCalibration(abs(calibration.drift) + 4 * calibration.deviation);
+    return constrain(learned, margin, 2 * margin);
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline int16_t SplitflapModuleBank<N>::RoundHomeCalibration(int16_t value) {
+    return (value + (value < 0 ? -HOME_CALIBRATION_SCALE / 2 : HOME_CALIBRATION_SCALE / 2)) / HOME_CALIBRATION_SCALE;
+}
+
+/**
+ * Re-homes module i after an unexpected home blip. Rather than crawling up to a whole revolution from here, assume the
+ * blip was home: the next one should be a revolution on, so approach that at full speed and only slow down to search
+ * within the home window around it. If home isn't there after all, fall back to a full slow search.
+ */
+template <uint8_t N>
+void SplitflapModuleBank<N>::GoToPredictedHome(uint8_t i) {
+    if (!fast_rehome) {
+        GoHome(i);
+        return;
+    }
+    const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+    uint16_t revolution_steps = pgm_read_word_near(spool.flap_start + spool.num_flaps);
+    uint16_t window = GetHomeWindowSteps(i);
+
+    state[i] = LOOK_FOR_HOME;
+    delta_steps[i] = revolution_steps + window;
+    home_search_slow_steps[i] = 2 * window;
+    home_search_fallback[i] = true;
+}
+
+/**
+ * Re-homes module i after it missed an expected home blip. The motor has most likely lost steps, leaving home somewhere
+ * ahead within the next revolution. Once the offset at full speed has been learned (see UpdateHomeCalibration), home is
+ * recognized just as well at full speed, so search the next revolution at full speed rather than crawling, and fall back
+ * to a full slow search if home doesn't turn up.
+ */
+template <uint8_t N>
+void SplitflapModuleBank<N>::GoToMissedHome(uint8_t i) {
+    if (!fast_rehome) {
+        GoHome(i);
+        return;
+    }
+    const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+
+    state[i] = LOOK_FOR_HOME;
+    delta_steps[i] = pgm_read_word_near(spool.flap_start + spool.num_flaps);
+    home_search_slow_steps[i] = 0;
+    home_search_fallback[i] = true;
+}
+
+// Speed while looking for home: full speed on the approach to a predicted home, decelerating to search speed by the
+// time the search itself starts
+template <uint8_t N>
+__attribute__((always_inline))
+inline uint8_t SplitflapModuleBank<N>::GetHomeSearchAccelStep(uint8_t i) {
+    const uint8_t search_accel_step = Acceleration::MAX_ACCEL_STEP / 8;
+    if (delta_steps[i] <= home_search_slow_steps[i]) {
+        return search_accel_step;
+    }
+    uint32_t approach_steps = delta_steps[i] - home_search_slow_steps[i];
+    if (approach_steps > Acceleration::MAX_ACCEL_STEP) {
+        return Acceleration::MAX_ACCEL_STEP;
+    }
+    return approach_steps > search_accel_step ? approach_steps : search_accel_step;
+}
+#endif
+
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::GoToFlapIndex(uint8_t i, uint8_t index) {
+    if (state[i] != NORMAL
+#if HOME_CALIBRATION_ENABLED
+     && state[i] != LOOK_FOR_HOME
+#endif
+    ) {
+        return;
+    }
+    // An explicit target supersedes any queued sequence
+    target_queue_count[i] = 0;
+    target_flap_index[i] = index;
+    GoToTargetFlapIndex(i);
+}
+
+/**
+ * Adds a target for module i to move on to after its current (and any previously queued) targets. Returns false if
+ * the queue is full.
+ */
+template <uint8_t N>
+bool SplitflapModuleBank<N>::QueueFlapIndex(uint8_t i, uint8_t index) {
+    if (target_queue_count[i] >= TARGET_QUEUE_LENGTH) {
+        return false;
+    }
+    uint8_t tail = target_queue_head[i] + target_queue_count[i];
+    if (tail >= TARGET_QUEUE_LENGTH) {
+        tail -= TARGET_QUEUE_LENGTH;
+    }
+    target_queue[i][tail] = index;
+    target_queue_count[i]++;
+    return true;
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::ClearQueuedFlapIndices(uint8_t i) {
+    target_queue_count[i] = 0;
+}
+
+template <uint8_t N>
+uint8_t SplitflapModuleBank<N>::GetQueuedFlapCount(uint8_t i) {
+    return target_queue_count[i];
+}
+
+// Minimum time a module shows each flap before moving on to its next queued target
+template <uint8_t N>
+void SplitflapModuleBank<N>::SetDwellMillis(uint8_t i, uint16_t dwell_millis) {
+    this->dwell_millis[i] = dwell_millis;
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::GoToQueuedFlapIndex(uint8_t i, unsigned long now) {
+    if (now - stopped_micros[i] < (unsigned long)dwell_millis[i] * 1000) {
+        return;
+    }
+
+    uint8_t index = target_queue[i][target_queue_head[i]];
+    target_queue_head[i]++;
+    if (target_queue_head[i] == TARGET_QUEUE_LENGTH) {
+        target_queue_head[i] = 0;
+    }
+    target_queue_count[i]--;
+
+    if (index == target_flap_index[i]) {
+        // Already showing it; going there would mean a full revolution. Just show it for another dwell period.
+        stopped_micros[i] = now;
+        return;
+    }
+    target_flap_index[i] = index;
+    GoToTargetFlapIndex(i);
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline uint8_t SplitflapModuleBank<N>::GetCurrentFlapIndex(uint8_t i) {
+   uint8_t num_flaps = Spool::VARIANTS[spool_variant[i]].num_flaps;
+   uint8_t flap = GetFlapFloor(i, current_step[i]);
+   while (flap >= num_flaps) {
+       flap -= num_flaps;
+   }
+   return flap;
+}
+
+template <uint8_t N>
+uint8_t SplitflapModuleBank<N>::GetTargetFlapIndex(uint8_t i) {
+   return target_flap_index[i];
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::GoHome(uint8_t i) {
+#if HOME_CALIBRATION_ENABLED
+    if (state[i] == PANIC || state[i] == STATE_DISABLED) {
+        return;
+    }
+
+    state[i] = LOOK_FOR_HOME;
+    delta_steps[i] = Spool::VARIANTS[spool_variant[i]].max_steps_looking_for_home;
+    home_search_slow_steps[i] = delta_steps[i];
+    home_search_fallback[i] = false;
+#endif
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::Update() {
+    unsigned long now = micros();
+    for (uint8_t i = 0; i < N; i++) {
+        UpdateModule(i, now);
+    }
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::UpdateModule(uint8_t i, unsigned long now) {
+    if (state[i] == PANIC || state[i] == STATE_DISABLED) {
+        return;
+    }
+
+    unsigned long delta_time = now - last_update_micros[i];
+    if (delta_time >= current_period[i]) {
+        StepModule(i, now);
+    }
+}
+
+/**
+ * Runs one motion update for module i unconditionally (i.e. without checking whether its current step period has
+ * elapsed). Callers that track step deadlines themselves (see StepScheduler) use this directly.
+ */
+template <uint8_t N>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N>::StepModule(uint8_t i, unsigned long now) {
+    if (state[i] == PANIC || state[i] == STATE_DISABLED) {
+        return;
+    }
+
+    last_update_micros[i] = now;
+
+    // Ramp tables aren't interchangeable mid-ramp, so a new profile only takes effect from rest. Homing always uses
+    // the default profile.
+    if (current_accel_step[i] == 0) {
+        active_profile[i] = state[i] == LOOK_FOR_HOME ? (uint8_t)Acceleration::PROFILE_DEFAULT : motion_profile[i];
+    }
+    const Acceleration::ProfileInfo &profile = Acceleration::PROFILES[active_profile[i]];
+
+    uint8_t target_accel_step;
+
+    if (state[i] == NORMAL) {
+        if (delta_steps[i] == 0 && current_accel_step[i] == 0 && target_queue_count[i] > 0) {
+            GoToQueuedFlapIndex(i, now);
+        }
+
+        bool reset_to_home = false;
+#if HOME_CALIBRATION_ENABLED
+        bool found_home = CheckSensor(i);
+        if (home_state[i] == IGNORE) {
+#if VERBOSE_LOGGING
+            if (found_home) {
+                Serial.print("VERBOSE: Ignoring home");
+            }
+#endif
+            if (current_step[i] == unexpected_home_start_step[i]) {
+                home_state[i] = UNEXPECTED;
+            }
+        } else if (home_state[i] == UNEXPECTED) {
+            if (found_home) {
+              count_unexpected_home[i]++;
+#if VERBOSE_LOGGING
+                Serial.print("VERBOSE: Unexpected home! At ");
+                Serial.print(current_step[i]);
+                Serial.print(". Unexpected range ");
+                Serial.print(unexpected_home_start_step[i]);
+                Serial.print('-');
+                Serial.print(unexpected_home_end_step[i]);
+                Serial.print("; missed at ");
+                Serial.print(missed_home_step[i]);
+                Serial.print(".\n");
+#endif
+                reset_to_home = true;
+            } else if (current_step[i] == unexpected_home_end_step[i]) {
+                home_state[i] = EXPECTED;
+            }
+        } else if (home_state[i] == EXPECTED) {
+            if (FAKE_HOME_SENSOR || found_home) {
+#if VERBOSE_LOGGING
+                Serial.print("VERBOSE: Found expected home.");
+#endif
+                UpdateHomeCalibration(i);
+                UpdateExpectedHome(i);
+            } else if (current_step[i] == missed_home_step[i]) {
+              count_missed_home[i]++;
+#if VERBOSE_LOGGING
+                Serial.print("VERBOSE: Missed expected home! At ");
+                Serial.print(current_step[i]);
+                Serial.print(". Expected between ");
+                Serial.print(unexpected_home_end_step[i]);
+                Serial.print(" and ");
+                Serial.print(missed_home_step[i]);
+                Serial.print(".\n");
+#endif
+                reset_to_home = true;
+            }
+        }
+#endif
+
+        if (reset_to_home) {
+#if HOME_CALIBRATION_ENABLED
+            // An unexpected blip tells us where home is; a missed one is most likely just ahead (the motor has lost
+            // steps), so search for it from here
+#if HOME_ERROR_TELEMETRY_ENABLED
+            RecordRecovery(i);
+#endif
+            if (found_home) {
+                GoToPredictedHome(i);
+            } else {
+                GoToMissedHome(i);
+            }
+#endif
+            target_accel_step = 0;
+        } else {
+            // Update speed based on distance to target
+            if (delta_steps[i] > profile.max_accel_step) {
+                target_accel_step = profile.max_accel_step;
+            } else {
+                target_accel_step = delta_steps[i];
+            }
+        }
+#if HOME_CALIBRATION_ENABLED
+    } else if (state[i] == LOOK_FOR_HOME) {
+        bool found_home = CheckSensor(i);
+        if (FAKE_HOME_SENSOR || found_home) {
+#if VERBOSE_LOGGING
+            Serial.print("VERBOSE: Found home!\n");
+#endif
+            state[i] = NORMAL;
+            target_accel_step = 0;
+
+            // Reset frame of reference. Home may turn up early while still approaching a predicted home at speed, in
+            // which case it's seen at the learned offset rather than where homing at search speed would find it.
+            bool at_speed = current_accel_step[i] > Acceleration::MAX_ACCEL_STEP / 8;
+            int16_t offset = at_speed ? RoundHomeCalibration(home_calibration[i].offset) : 0;
+            current_step[i] = offset < 0 ? Spool::VARIANTS[spool_variant[i]].input_steps + offset : offset;
+            unexpected_home_start_step[i] = 0;
+            unexpected_home_end_step[i] = 0;
+            missed_home_step[i] = 0;
+            first_home_since_homing[i] = !at_speed;
+            UpdateExpectedHome(i);
+
+            GoToTargetFlapIndex(i);
+        } else {
+            if (delta_steps[i] == 0 && home_search_fallback[i]) {
+#if VERBOSE_LOGGING
+                Serial.print("VERBOSE: Home not where predicted; searching\n");
+#endif
+                GoHome(i);
+            }
+            if (delta_steps[i] == 0) {
+#if VERBOSE_LOGGING
+                Serial.print("VERBOSE: Gave up looking for home!\n");
+#endif
+                state[i] = SENSOR_ERROR;
+                target_accel_step = 0;
+            } else {
+                // If homing started mid-move on another profile, come to rest so we can switch to the default
+                target_accel_step = active_profile[i] == Acceleration::PROFILE_DEFAULT ? GetHomeSearchAccelStep(i) : 0;
+            }
+        }
+#endif
+    } else {
+        target_accel_step = 0;
+    }
+
+    // Update motor
+    if (current_accel_step[i] < target_accel_step) {
+        current_accel_step[i]++;
+    } else if (current_accel_step[i] > target_accel_step) {
+        current_accel_step[i]--;
+        if (current_accel_step[i] == 0) {
+            stopped_micros[i] = now;
+        }
+    }
+
+    current_period[i] = pgm_read_word_near(profile.periods + current_accel_step[i]);
+
+    if (current_accel_step[i] > 0) {
+        current_step[i]++;
+        if (current_step[i] == Spool::VARIANTS[spool_variant[i]].input_steps) {
+            current_step[i] = 0;
+        }
+        current_phase[i]++;
+        if (current_phase[i] == sizeof(step_pattern)) {
+            current_phase[i] = 0;
+        }
+        if (delta_steps[i] > 0) {
+            delta_steps[i]--;
+        }
+        SetMotor(i, step_pattern[current_phase[i]]);
+    } else {
+        SetMotor(i, 0);
+    }
+
+#if ASSERTIONS_ENABLED
+    // Check modular arithmetic invariant
+    if (current_step[i] >= Spool::VARIANTS[spool_variant[i]].input_steps) {
+        Panic(i, "current_step >= input_steps");
+    }
+#endif
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline unsigned long SplitflapModuleBank<N>::GetNextStepMicros(uint8_t i) {
+    return last_update_micros[i] + current_period[i];
+}
+
+template <uint8_t N>
+__attribute__((always_inline))
+inline uint16_t SplitflapModuleBank<N>::GetStepPeriod(uint8_t i) {
+    return current_period[i];
+}
+
+/**
+ * Whether updating module i would be a no-op until it receives a new command: it's stopped with nowhere to go, or it
+ * can't move at all. A parked module's state is fully frozen, so updates can be skipped entirely.
+ */
+template <uint8_t N>
+__attribute__((always_inline))
+inline bool SplitflapModuleBank<N>::IsParked(uint8_t i) {
+    if (state[i] == PANIC || state[i] == STATE_DISABLED) {
+        return true;
+    }
+    if (current_accel_step[i] != 0) {
+        return false;
+    }
+    if (state[i] == NORMAL) {
+        return delta_steps[i] == 0 && target_queue_count[i] == 0;
+    }
+    return state[i] == SENSOR_ERROR;
+}
+
+/**
+ * Whether module i is speeding up (or about to start moving), as opposed to cruising, slowing down or stopped. This is
+ * when a motor draws the most current.
+ */
+template <uint8_t N>
+__attribute__((always_inline))
+inline bool SplitflapModuleBank<N>::IsAccelerating(uint8_t i) {
+    uint8_t target_accel_step;
+    if (state[i] == NORMAL) {
+        uint8_t max_accel_step = Acceleration::PROFILES[active_profile[i]].max_accel_step;
+        target_accel_step = delta_steps[i] > max_accel_step ? max_accel_step : delta_steps[i];
+#if HOME_CALIBRATION_ENABLED
+    } else if (state[i] == LOOK_FOR_HOME) {
+        target_accel_step = GetHomeSearchAccelStep(i);
+#endif
+    } else {
+        return false;
+    }
+    return current_accel_step[i] < target_accel_step;
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::ResetErrorCounters(uint8_t i) {
+  count_unexpected_home[i] = 0;
+  count_missed_home[i] = 0;
+}
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::ResetState(uint8_t i) {
+    ResetErrorCounters(i);
+    CheckSensor(i);
+
+    target_flap_index[i] = 0;
+    target_queue_count[i] = 0;
+    current_step[i] = 0;
+    delta_steps[i] = 0;
+
+#if HOME_CALIBRATION_ENABLED
+    home_state[i] = IGNORE;
+    unexpected_home_start_step[i] = 0;
+    unexpected_home_end_step[i] = 0;
+    missed_home_step[i] = 0;
+#endif
+}
+
+/**
+ * Selects the Acceleration::Profile used for module i's subsequent moves (once it next comes to rest, if it's currently
+ * moving). Unknown profiles fall back to the default.
+ */
+template <uint8_t N>
+void SplitflapModuleBank<N>::SetMotionProfile(uint8_t i, uint8_t profile) {
+    motion_profile[i] = profile < Acceleration::NUM_PROFILES ? profile : (uint8_t)Acceleration::PROFILE_DEFAULT;
+}
+
+template <uint8_t N>
+uint8_t SplitflapModuleBank<N>::GetMotionProfile(uint8_t i) {
+    return motion_profile[i];
+}
+
+/**
+ * Selects the Spool::Variant fitted to module i. This changes the module's frame of reference, so it resets the
+ * module's position; call GoHome() afterwards. Unknown variants fall back to the default.
+ */
+template <uint8_t N>
+void SplitflapModuleBank<N>::SetSpool(uint8_t i, uint8_t variant) {
+    spool_variant[i] = variant < Spool::NUM_SPOOL_VARIANTS ? variant : (uint8_t)Spool::SPOOL_DEFAULT;
+    ResetState(i);
+}
+
+template <uint8_t N>
+uint8_t SplitflapModuleBank<N>::GetSpool(uint8_t i) {
+    return spool_variant[i];
+}
+
+template <uint8_t N>
+uint8_t SplitflapModuleBank<N>::GetNumFlaps(uint8_t i) {
+    return Spool::VARIANTS[spool_variant[i]].num_flaps;
+}
+
+// Position within the spool's frame of reference (see RestorePosition)
+template <uint8_t N>
+uint32_t SplitflapModuleBank<N>::GetCurrentStep(uint8_t i) {
+    return current_step[i];
+}
+
+/**
+ * Puts module i back at a previously known position (e.g. saved before a reboot, while the module was at rest) instead
+ * of homing it. The position is trusted until the module next passes home, where it's checked like any other home
+ * blip: if home isn't where the restored position says it should be, the module re-homes. Returns false, leaving the
+ * module untouched, if the position isn't valid for its spool.
+ */
+template <uint8_t N>
+bool SplitflapModuleBank<N>::RestorePosition(uint8_t i, uint32_t step, uint8_t target_flap_index) {
+    const Spool::Info &spool = Spool::VARIANTS[spool_variant[i]];
+    if (state[i] == PANIC || state[i] == STATE_DISABLED || step >= spool.input_steps ||
+            target_flap_index >= spool.num_flaps) {
+        return false;
+    }
+
+    CheckSensor(i);
+    state[i] = NORMAL;
+    current_step[i] = step;
+    delta_steps[i] = 0;
+    this->target_flap_index[i] = target_flap_index;
+    target_queue_count[i] = 0;
+
+#if HOME_CALIBRATION_ENABLED
+    // The frame of reference (and learned offset) is the one from before the reboot, so there's nothing to relearn
+    first_home_since_homing[i] = false;
+    missed_home_step[i] = step;
+    UpdateExpectedHome(i);
+
+    // Unlike after a home blip, the module could be anywhere relative to home
+    uint16_t window = GetHomeWindowSteps(i);
+    uint32_t steps_to_home = expected_home_step[i] >= step ?
+        expected_home_step[i] - step : expected_home_step[i] + spool.input_steps - step;
+    uint16_t revolution_steps = pgm_read_word_near(spool.flap_start + spool.num_flaps);
+    if (steps_to_home <= window) {
+        home_state[i] = EXPECTED;
+    } else if (steps_to_home + window < revolution_steps) {
+        home_state[i] = UNEXPECTED;
+    }
+    // Otherwise it's only just past home, so ignore any blip until it's moved on, as after finding home
+#endif
+    return true;
+}
+
+#if HOME_CALIBRATION_ENABLED
+template <uint8_t N>
+const HomeCalibration &SplitflapModuleBank<N>::GetHomeCalibration(uint8_t i) {
+    return home_calibration[i];
+}
+
+// Restores previously learned calibration for module i (e.g. from persistent storage). Takes effect from its next home.
+template <uint8_t N>
+void SplitflapModuleBank<N>::SetHomeCalibration(uint8_t i, const HomeCalibration &calibration) {
+    int16_t limit = Spool::VARIANTS[spool_variant[i]].home_error_margin_steps * HOME_CALIBRATION_SCALE;
+    home_calibration[i].offset = constrain(calibration.offset, -limit, limit);
+    home_calibration[i].drift = constrain(calibration.drift, -limit, limit);
+    home_calibration[i].deviation = constrain(calibration.deviation, 0, limit);
+}
+
+// Incremented whenever any module's calibration is updated, so callers can tell when it's worth saving
+template <uint8_t N>
+uint16_t SplitflapModuleBank<N>::GetHomeCalibrationGeneration() {
+    return home_calibration_generation;
+}
+
+// Whether an unexpected or missed home blip re-homes at full speed (see GoToPredictedHome and GoToMissedHome) rather
+// than with a full slow search
+template <uint8_t N>
+void SplitflapModuleBank<N>::SetFastRehome(bool enabled) {
+    fast_rehome = enabled;
+}
+
+#if HOME_ERROR_TELEMETRY_ENABLED
+template <uint8_t N>
+const HomeErrorTelemetry &SplitflapModuleBank<N>::GetHomeErrorTelemetry(uint8_t i) {
+    return home_error_telemetry[i];
+}
+
+// Incremented whenever any module's telemetry changes, so callers only need to copy it out when it has
+template <uint8_t N>
+uint16_t SplitflapModuleBank<N>::GetHomeErrorTelemetryGeneration() {
+    return home_error_telemetry_generation;
+}
+#endif
+#endif
+
+template <uint8_t N>
+void SplitflapModuleBank<N>::Init(uint8_t i) {
+    CheckSensor(i);
+}
+
+template <uint8_t N>
+bool SplitflapModuleBank<N>::GetHomeState(uint8_t i) {
+  return home_level[i];
+}
+
+#endif
@@ -17,6 +17,28 @@
 
 #include "../config.h"
 
+// Number of pending flap targets each module can hold (see SplitflapModuleBank::QueueFlapIndex)
+#ifndef TARGET_QUEUE_LENGTH
+#ifdef __AVR__
+#define TARGET_QUEUE_LENGTH 2
+#else
+#define TARGET_QUEUE_LENGTH 8
+#endif
+#endif
+
+// Whether modules keep HomeErrorTelemetry (see SplitflapModuleBank::GetHomeErrorTelemetry)
+#ifndef HOME_ERROR_TELEMETRY_ENABLED
+#ifdef __AVR__
+#define HOME_ERROR_TELEMETRY_ENABLED false
+#else
+#define HOME_ERROR_TELEMETRY_ENABLED HOME_CALIBRATION_ENABLED
+#endif
+#endif
+
+#if HOME_ERROR_TELEMETRY_ENABLED && !HOME_CALIBRATION_ENABLED
+#error HOME_ERROR_TELEMETRY_ENABLED requires HOME_CALIBRATION_ENABLED
+#endif
+
 #if HOME_CALIBRATION_ENABLED
 enum HomeState {
     // Ignore any home blips (e.g. if we've just seen the home position and haven't traveled past it yet)
@@ -26,6 +48,45 @@ enum HomeState {
     // Home position is expected in this state/region
     EXPECTED,
 };
+
+// Fixed point scale of HomeCalibration values, i.e. they're in 1/HOME_CALIBRATION_SCALE steps
+#define HOME_CALIBRATION_SCALE 16
+
+/**
+ * What a module has learned about its home sensor from the home blips it sees in normal motion (see
+ * SplitflapModuleBank::UpdateHomeCalibration). Worth persisting, so a module doesn't have to relearn it every boot.
+ */
+struct HomeCalibration {
+    // Where home is seen while moving, relative to where homing (at low speed) found it
+    int16_t offset;
+
+    // Average error per revolution after allowing for offset; positive when the motor is losing steps
+    int16_t drift;
+
+    // Average deviation of the error from drift, i.e. how noisy the sensor is
+    int16_t deviation;
+};
+
+#if HOME_ERROR_TELEMETRY_ENABLED
+// Bins of HomeErrorTelemetry::histogram, by how far (in steps) a home blip was from where it was expected:
+// <= -7, -6..-3, -2..-1, 0, 1..2, 3..6, >= 7. Negative is early, i.e. the motor gained steps or the sensor is noisy.
+#define HOME_ERROR_HISTOGRAM_BINS 7
+
+/**
+ * Long-running record of how well a module is tracking its position, for spotting modules that are wearing out or
+ * badly adjusted before they start visibly misbehaving. Never reset, unlike the count_*_home error counters.
+ */
+struct HomeErrorTelemetry {
+    // Count of home blips seen in normal motion per error bin (saturating)
+    uint16_t histogram[HOME_ERROR_HISTOGRAM_BINS];
+
+    // Number of times the module lost track of its position and had to re-home
+    uint32_t recoveries;
+
+    // millis() at the last recovery (only meaningful if recoveries > 0)
+    uint32_t last_error_millis;
+};
+#endif
 #endif
 
 enum State {
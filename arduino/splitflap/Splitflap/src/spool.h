@@ -0,0 +1,178 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef SPOOL_H
+#define SPOOL_H
+
+#include <stdint.h>
+
+#include "index_sequence.h"
+#include "../config.h"
+
+// Driver steps per full motor step (see HALF_STEP)
+#define STEPS_PER_FULL_STEP (HALF_STEP ? 2 : 1)
+
+#define STEPS_PER_MOTOR_REVOLUTION (32 * STEPS_PER_FULL_STEP)
+
+// The gear ratio constants below represent the input:output ratio of the gearbox expressed as a simplified fraction.
+// For example, for a gear train with ratios 31:10, 26:9, 22:11, 32:9, the overall ratio expressed as integers would be
+// (31*26*22*32):(10*9*11*9) == 567424:8910 == 25792:405 ~= 63.684:1. To avoid floating point math, we would use the
+// simplified integer fraction values 25792 and 405.
+#define _GEAR_RATIO_INPUT (128)
+#define _GEAR_RATIO_OUTPUT (2)
+
+// All motion is tracked in terms of motor steps (rather than motor revolutions), so we pre-multiply the gear ratio input
+// by the number of motor steps per revolution as a more useful quantity to work with.
+#define GEAR_RATIO_INPUT_STEPS (STEPS_PER_MOTOR_REVOLUTION * _GEAR_RATIO_INPUT)
+
+// Likewise, we care about the number of flaps flipped, rather than the number of output shaft revolutions, so we
+// pre-multiply the gear ratio output by the number of flaps per revolution as a more useful quantity to work with.
+#define GEAR_RATIO_OUTPUT_FLAPS (_GEAR_RATIO_OUTPUT * NUM_FLAPS)
+
+namespace Spool {
+
+/**
+ * Runtime description of a spool/gearbox combination, generated by Geometry below. Step positions count motor steps
+ * modulo input_steps, which covers a whole number of spool revolutions.
+ */
+struct Info {
+    uint8_t num_flaps;
+    uint16_t input_steps;
+
+    // PROGMEM table; flap_start[k] is the first step at which flap k is showing. k counts on past num_flaps into later
+    // revolutions, up to a full revolution past the last flap position before input_steps.
+    const uint16_t* flap_start;
+
+    // PROGMEM table of the flap showing at the first step of each bucket of 2^bucket_shift steps. Buckets are no wider
+    // than a flap, so each contains at most one flap_start.
+    const uint8_t* bucket_flap;
+    uint8_t bucket_shift;
+
+    // Home calibration tolerances
+    uint16_t home_error_margin_steps;
+    uint16_t unexpected_home_start_buffer_steps;
+    uint16_t max_steps_looking_for_home;
+};
+
+/**
+ * A spool of NumFlaps flaps driven through a gearbox that turns it OutputRevolutions times every InputSteps motor steps.
+ *
+ * Mapping between steps and flaps is done with lookup tables computed at compile time and stored in PROGMEM, so moving
+ * and reporting position needs no multiplication or division at runtime.
+ */
+template <uint8_t NumFlaps, uint16_t InputSteps, uint8_t OutputRevolutions>
+struct Geometry {
+    static constexpr uint16_t OUTPUT_FLAPS = (uint16_t)OutputRevolutions * NumFlaps;
+
+    // This is "rough" because it's integer division; it's only used for tolerances
+    static constexpr uint16_t ROUGH_STEPS_PER_FLAP = InputSteps / OUTPUT_FLAPS;
+
+    static_assert(OUTPUT_FLAPS <= 255, "Flap positions must fit in a uint8_t");
+    static_assert(ROUGH_STEPS_PER_FLAP >= 1, "Flaps must be at least one step apart");
+
+    // Flap showing at the given step (i.e. the inverse of FlapStart)
+    static constexpr uint8_t FlapFloor(uint32_t step) {
+        return step * OUTPUT_FLAPS / InputSteps;
+    }
+
+    // First step at which flap k is showing. Rounds up so that FlapFloor(FlapStart(k)) == k.
+    static constexpr uint16_t FlapStart(uint32_t k) {
+        return (k * InputSteps + OUTPUT_FLAPS - 1) / OUTPUT_FLAPS;
+    }
+
+    static constexpr uint8_t Log2(uint16_t x) {
+        return x <= 1 ? 0 : 1 + Log2(x / 2);
+    }
+
+    static constexpr uint8_t BUCKET_SHIFT = Log2(ROUGH_STEPS_PER_FLAP);
+    static constexpr uint16_t NUM_BUCKETS = (InputSteps + (1 << BUCKET_SHIFT) - 1) >> BUCKET_SHIFT;
+
+    // A move starts from a flap position < OUTPUT_FLAPS and travels at most a full revolution
+    static constexpr uint16_t NUM_FLAP_STARTS = OUTPUT_FLAPS + NumFlaps;
+
+    static_assert((uint32_t)FlapStart(NUM_FLAP_STARTS - 1) <= 65535, "Step positions must fit in a uint16_t");
+
+    template <typename Sequence>
+    struct Tables;
+
+    template <size_t... K>
+    struct Tables<IndexSequence<K...>> {
+        static const uint16_t FLAP_START[sizeof...(K)];
+    };
+
+    template <typename Sequence>
+    struct Buckets;
+
+    template <size_t... B>
+    struct Buckets<IndexSequence<B...>> {
+        static const uint8_t BUCKET_FLAP[sizeof...(B)];
+    };
+
+    typedef Tables<typename MakeIndexSequence<NUM_FLAP_STARTS>::type> FlapStarts;
+    typedef Buckets<typename MakeIndexSequence<NUM_BUCKETS>::type> BucketFlaps;
+
+    static constexpr Info Describe() {
+        return Info {
+            NumFlaps,
+            InputSteps,
+            FlapStarts::FLAP_START,
+            BucketFlaps::BUCKET_FLAP,
+            BUCKET_SHIFT,
+            (uint16_t)(ROUGH_STEPS_PER_FLAP / 4),
+            (uint16_t)(ROUGH_STEPS_PER_FLAP * 5),
+            (uint16_t)((NumFlaps + 2) * ROUGH_STEPS_PER_FLAP),
+        };
+    }
+};
+
+template <uint8_t NumFlaps, uint16_t InputSteps, uint8_t OutputRevolutions>
+template <size_t... K>
+const PROGMEM uint16_t Geometry<NumFlaps, InputSteps, OutputRevolutions>::Tables<IndexSequence<K...>>::FLAP_START[sizeof...(K)] = {
+    Geometry<NumFlaps, InputSteps, OutputRevolutions>::FlapStart(K)...
+};
+
+template <uint8_t NumFlaps, uint16_t InputSteps, uint8_t OutputRevolutions>
+template <size_t... B>
+const PROGMEM uint8_t Geometry<NumFlaps, InputSteps, OutputRevolutions>::Buckets<IndexSequence<B...>>::BUCKET_FLAP[sizeof...(B)] = {
+    Geometry<NumFlaps, InputSteps, OutputRevolutions>::FlapFloor(B << Geometry<NumFlaps, InputSteps, OutputRevolutions>::BUCKET_SHIFT)...
+};
+
+typedef Geometry<NUM_FLAPS, GEAR_RATIO_INPUT_STEPS, _GEAR_RATIO_OUTPUT> Default;
+typedef Geometry<40, GEAR_RATIO_INPUT_STEPS, _GEAR_RATIO_OUTPUT> Flaps40;
+typedef Geometry<52, GEAR_RATIO_INPUT_STEPS, _GEAR_RATIO_OUTPUT> Flaps52;
+
+/**
+ * Spool variants that can be selected per module at runtime (see SplitflapModuleBank::SetSpool), so displays can mix
+ * 40- and 52-flap modules on the same chain. Tables are shared between variants with identical geometry.
+ */
+enum Variant {
+    SPOOL_DEFAULT,
+    SPOOL_40_FLAP,
+    SPOOL_52_FLAP,
+    NUM_SPOOL_VARIANTS,
+};
+
+const Info VARIANTS[NUM_SPOOL_VARIANTS] = {
+    Default::Describe(),
+    Flaps40::Describe(),
+    Flaps52::Describe(),
+};
+
+// Largest number of flaps on any variant
+constexpr uint8_t MAX_NUM_FLAPS = NUM_FLAPS > 52 ? NUM_FLAPS : 52;
+
+}
+#endif
@@ -0,0 +1,200 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STEP_SCHEDULER_H
+#define STEP_SCHEDULER_H
+
+#include <Arduino.h>
+
+#include "splitflap_module_bank.h"
+
+/**
+ * Deadline-driven alternative to SplitflapModuleBank::Update().
+ *
+ * Modules that are moving are kept in a binary min-heap keyed by the time of their next step, so each call to Update()
+ * only touches the modules that are actually due (O(due * log N) rather than O(N)). Modules that come to rest are
+ * "parked" (see SplitflapModuleBank::IsParked) and dropped from the heap entirely; anything that gives a module new
+ * work (GoToFlapIndex, GoHome, etc) must be followed by a call to Wake() so the scheduler picks it back up.
+ */
+template <uint8_t N>
+class StepScheduler {
+ private:
+  // Heap positions are always < N <= 255, so this can't be a valid position
+  static const uint8_t NOT_SCHEDULED = 0xFF;
+
+  SplitflapModuleBank<N> &bank;
+
+  // heap[0..size) holds module indices ordered by deadline; position[i] is module i's index in heap
+  uint8_t heap[N];
+  uint8_t position[N];
+  unsigned long deadline[N];
+  uint8_t size;
+
+  // See Update()
+  const uint16_t max_catch_up_micros;
+
+  // Compares timestamps in a way that is robust to micros() wrapping around
+  static bool Before(unsigned long a, unsigned long b) {
+    return (long)(a - b) < 0;
+  }
+
+  void Swap(uint8_t a, uint8_t b);
+  void SiftUp(uint8_t pos);
+  void SiftDown(uint8_t pos);
+  void Remove(uint8_t pos);
+
+ public:
+  StepScheduler(SplitflapModuleBank<N> &bank);
+
+  // Schedules module i to be updated as soon as its step period allows
+  void Wake(uint8_t i, unsigned long now);
+
+  // Updates every module whose deadline has passed. Returns the number of modules updated.
+  uint8_t Update(unsigned long now);
+
+  // True if every module is parked
+  bool IsIdle() const { return size == 0; }
+
+  // True if module i is awake (i.e. not parked)
+  bool IsScheduled(uint8_t i) const { return position[i] != NOT_SCHEDULED; }
+
+  // Microseconds until the earliest deadline (0 if already due). Only meaningful if !IsIdle().
+  unsigned long GetMicrosUntilNext(unsigned long now) const;
+};
+
+template <uint8_t N>
+StepScheduler<N>::StepScheduler(SplitflapModuleBank<N> &bank) :
+    bank(bank),
+    size(0),
+    max_catch_up_micros(Acceleration::MIN_STEP_PERIOD / 2) {
+  for (uint8_t i = 0; i < N; i++) {
+    position[i] = NOT_SCHEDULED;
+    deadline[i] = 0;
+  }
+}
+
+template <uint8_t N>
+inline void StepScheduler<N>::Swap(uint8_t a, uint8_t b) {
+  uint8_t module_a = heap[a];
+  heap[a] = heap[b];
+  heap[b] = module_a;
+  position[heap[a]] = a;
+  position[heap[b]] = b;
+}
+
+template <uint8_t N>
+inline void StepScheduler<N>::SiftUp(uint8_t pos) {
+  while (pos > 0) {
+    uint8_t parent = (pos - 1) / 2;
+    if (!Before(deadline[heap[pos]], deadline[heap[parent]])) {
+      break;
+    }
+    Swap(pos, parent);
+    pos = parent;
+  }
+}
+
+template <uint8_t N>
+inline void StepScheduler<N>::SiftDown(uint8_t pos) {
+  while (true) {
+    uint16_t left = 2 * (uint16_t)pos + 1;
+    // Checking against N as well as size lets the compiler see the heap is never indexed past its end
+    if (left >= size || left >= N) {
+      break;
+    }
+    uint8_t child = left;
+    if (left + 1 < size && left + 1 < N && Before(deadline[heap[left + 1]], deadline[heap[left]])) {
+      child = left + 1;
+    }
+    if (!Before(deadline[heap[child]], deadline[heap[pos]])) {
+      break;
+    }
+    Swap(pos, child);
+    pos = child;
+  }
+}
+
+template <uint8_t N>
+inline void StepScheduler<N>::Remove(uint8_t pos) {
+  uint8_t module = heap[pos];
+  size--;
+  // (With a single slot, the module removed is always the last one)
+  if (N > 1 && pos != size) {
+    Swap(pos, size);
+    SiftDown(pos);
+    SiftUp(pos);
+  }
+  position[module] = NOT_SCHEDULED;
+}
+
+template <uint8_t N>
+void StepScheduler<N>::Wake(uint8_t i, unsigned long now) {
+  if (position[i] != NOT_SCHEDULED) {
+    // Already moving; any new command takes effect at its next step
+    return;
+  }
+
+  // Don't step sooner than the module's current period allows (e.g. if it only just came to rest). The module may
+  // have been parked for arbitrarily long, so only trust its next step time if it's within one period of now.
+  unsigned long next_step = bank.GetNextStepMicros(i);
+  deadline[i] = (Before(now, next_step) && next_step - now <= bank.GetStepPeriod(i)) ? next_step : now;
+
+  heap[size] = i;
+  position[i] = size;
+  size++;
+  SiftUp(size - 1);
+}
+
+template <uint8_t N>
+inline uint8_t StepScheduler<N>::Update(unsigned long now) {
+  uint8_t updated = 0;
+  while (size > 0 && !Before(now, deadline[heap[0]])) {
+    uint8_t i = heap[0];
+    if (bank.IsParked(i)) {
+      // Woken without any new work (or disabled while scheduled)
+      Remove(0);
+      continue;
+    }
+
+    // Step "at" the scheduled time rather than now (phase accumulation), so that latency in noticing a deadline doesn't
+    // accumulate into the step cadence. If we've fallen too far behind, drop the lost time instead; catching up by
+    // more than half the shortest step period could require stepping twice before the next I/O.
+    unsigned long step_time = deadline[i];
+    if (now - step_time > max_catch_up_micros) {
+      step_time = now;
+    }
+    bank.StepModule(i, step_time);
+    updated++;
+
+    if (bank.IsParked(i)) {
+      Remove(0);
+    } else {
+      deadline[i] = bank.GetNextStepMicros(i);
+      SiftDown(0);
+    }
+  }
+  return updated;
+}
+
+template <uint8_t N>
+unsigned long StepScheduler<N>::GetMicrosUntilNext(unsigned long now) const {
+  if (size == 0 || !Before(now, deadline[heap[0]])) {
+    return 0;
+  }
+  return deadline[heap[0]] - now;
+}
+
+#endif
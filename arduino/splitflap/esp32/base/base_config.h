@@ -46,5 +46,8 @@
 #define MAX_MODULE_CURRENT_HOMING_MA    260
 #define MAX_MODULE_CURRENT_MOVING_MA    260 //180
 
+// Number of modules per power channel allowed to accelerate at once; other moves on that channel are staggered
+#define MAX_MODULES_ACCELERATING_PER_CHANNEL 8
+
 #define CONSECUTIVE_CURRENT_OUT_OF_RANGE_THRESHOLD  20
 #define CONSECUTIVE_UNEXPECTED_POWER_THRESHOLD 30
\ No newline at end of file
@@ -50,6 +50,10 @@ BaseSupervisorTask::BaseSupervisorTask(SplitflapTask& splitflap_task, SerialTask
         Task("BaseSupervisor", 8192, 1, task_core),
         splitflap_task_(splitflap_task),
         serial_task_(serial_task) {
+    static_assert(NUM_POWER_CHANNELS <= MAX_POWER_CHANNELS, "SplitflapTask can't budget this many power channels");
+
+    // Stagger module starts so that a channel's current never spikes past what runStateNormal() expects
+    splitflap_task_.setPowerChannels(getPowerChannelForModuleIndex, MAX_MODULES_ACCELERATING_PER_CHANNEL);
 }
 
 void BaseSupervisorTask::run() {
@@ -210,7 +214,7 @@ void BaseSupervisorTask::runStateStartingEnableChannels() {
             if (startup_enable_channel_ >= NUM_POWER_CHANNELS) {
                 serial_task_.log("All channels enabled, startup complete!");
                 state_ = PB_SupervisorState_State_NORMAL;
-                splitflap_task_.resetAll();
+                splitflap_task_.restorePositionsOrHomeAll();
                 return;
             }
 
@@ -353,7 +357,9 @@ void BaseSupervisorTask::readPower() {
 }
 
 void BaseSupervisorTask::updateSplitflapState() {
-    splitflap_state_ = splitflap_task_.getState();
+    if (splitflap_task_.getStateGeneration() != splitflap_state_generation_) {
+        splitflap_state_ = splitflap_task_.getState(&splitflap_state_generation_);
+    }
 }
 
 void BaseSupervisorTask::fault(PB_SupervisorState_FaultInfo_FaultType type, const char* msg) {
@@ -57,7 +57,9 @@ class BaseSupervisorTask : public Task<BaseSupervisorTask> {
         PB_SupervisorState_State state_ = PB_SupervisorState_State_UNKNOWN;
         PB_SupervisorState_FaultInfo fault_info_;
 
-        SplitflapState splitflap_state_;
+        // Starts out as generation 0 of SplitflapTask's state
+        SplitflapState splitflap_state_ = {};
+        uint32_t splitflap_state_generation_ = 0;
         float voltage_volts_[NUM_POWER_CHANNELS] = {};
         float current_amps_[NUM_POWER_CHANNELS] = {};
         bool channel_on_[NUM_POWER_CHANNELS] = {};
@@ -0,0 +1,97 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <Preferences.h>
+
+#include "character_sets.h"
+
+#define CHARACTER_SETS_PREFERENCES_NAMESPACE "charsets"
+#define CHARACTER_SETS_PREFERENCES_KEY "config"
+
+CharacterSets::CharacterSets() {
+    memset(&config_, 0, sizeof(config_));
+    config_.num_sets = 1;
+    config_.num_flaps[0] = NUM_FLAPS;
+    memcpy(config_.flaps[0], flaps, NUM_FLAPS);
+    buildLookup();
+}
+
+bool CharacterSets::isValid(const CharacterSetConfig& config) {
+    if (config.num_sets == 0 || config.num_sets > MAX_CHARACTER_SETS) {
+        return false;
+    }
+    for (uint8_t i = 0; i < config.num_sets; i++) {
+        if (config.num_flaps[i] > Spool::MAX_NUM_FLAPS) {
+            return false;
+        }
+    }
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        if (config.module_set[i] >= config.num_sets) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CharacterSets::set(const CharacterSetConfig& config) {
+    if (!isValid(config)) {
+        return false;
+    }
+    config_ = config;
+    buildLookup();
+    return true;
+}
+
+bool CharacterSets::load() {
+    CharacterSetConfig config;
+    Preferences p;
+    p.begin(CHARACTER_SETS_PREFERENCES_NAMESPACE, true);
+    size_t length = p.getBytes(CHARACTER_SETS_PREFERENCES_KEY, &config, sizeof(config));
+    p.end();
+    return length == sizeof(config) && set(config);
+}
+
+bool CharacterSets::save() const {
+    Preferences p;
+    p.begin(CHARACTER_SETS_PREFERENCES_NAMESPACE);
+    size_t length = p.putBytes(CHARACTER_SETS_PREFERENCES_KEY, &config_, sizeof(config_));
+    p.end();
+    return length == sizeof(config_);
+}
+
+uint8_t CharacterSets::getFlapCharacter(uint8_t module, uint8_t flap_index) const {
+    uint8_t set = config_.module_set[module];
+    return flap_index < config_.num_flaps[set] ? config_.flaps[set][flap_index] : '?';
+}
+
+void CharacterSets::buildLookup() {
+    for (uint8_t set = 0; set < config_.num_sets; set++) {
+        uint8_t* lookup = lookup_[set];
+        memset(lookup, NOT_FOUND, sizeof(lookup_[set]));
+
+        // If a character appears on more than one flap, use the first
+        for (uint8_t i = config_.num_flaps[set]; i > 0; i--) {
+            lookup[config_.flaps[set][i - 1]] = i - 1;
+        }
+
+        // Uppercase letters fall back to their lowercase flap, if they don't have one of their own
+        for (uint8_t c = 'A'; c <= 'Z'; c++) {
+            if (lookup[c] == NOT_FOUND) {
+                lookup[c] = lookup[c - 'A' + 'a'];
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "src/spool.h"
+
+#define MAX_CHARACTER_SETS 4
+
+/**
+ * Characters on each flap of every character set, and the set used by each module. This is also the format stored in
+ * NVS, so changing it invalidates previously saved character sets (they're ignored, falling back to the default).
+ */
+struct CharacterSetConfig {
+    uint8_t num_sets;
+    uint8_t num_flaps[MAX_CHARACTER_SETS];
+    uint8_t flaps[MAX_CHARACTER_SETS][Spool::MAX_NUM_FLAPS];
+    uint8_t module_set[NUM_MODULES];
+};
+
+/**
+ * Maps characters to flap indices (and back) for each module, for displays that mix modules with different flaps (e.g.
+ * letters, digits and colors).
+ *
+ * Each set keeps a 256-entry reverse lookup table, so finding a character's flap is a single array read. Not
+ * thread-safe; see SplitflapTask for synchronized access.
+ */
+class CharacterSets {
+    public:
+        static const uint8_t NOT_FOUND = 0xFF;
+
+        // Starts with a single set containing the flaps[] from config.h, used by every module
+        CharacterSets();
+
+        // Replaces every set and module assignment. Returns false, leaving the current sets untouched, if config is
+        // invalid.
+        bool set(const CharacterSetConfig& config);
+
+        // Replaces the current sets with those saved in NVS, if any. Returns false if none were loaded.
+        bool load();
+        bool save() const;
+
+        uint8_t findFlapIndex(uint8_t module, uint8_t character) const {
+            return lookup_[config_.module_set[module]][character];
+        }
+
+        // Character on the given flap of the module's set, or '?' if there's no such flap
+        uint8_t getFlapCharacter(uint8_t module, uint8_t flap_index) const;
+
+    private:
+        CharacterSetConfig config_;
+        uint8_t lookup_[MAX_CHARACTER_SETS][256];
+
+        static bool isValid(const CharacterSetConfig& config);
+        void buildLookup();
+};
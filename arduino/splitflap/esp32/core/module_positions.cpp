@@ -0,0 +1,133 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <Preferences.h>
+
+#include "module_positions.h"
+#include "src/spool.h"
+
+#define MODULE_POSITIONS_PREFERENCES_NAMESPACE "positions"
+#define MODULE_POSITIONS_PREFERENCES_KEY "modules"
+#define MODULE_POSITIONS_PREFERENCES_STALE_KEY "stale"
+
+#define MODULE_POSITIONS_RTC_MAGIC 0x53504F53
+
+struct RtcModulePositions {
+    uint32_t magic;
+    uint32_t layout;
+    uint32_t checksum;
+    ModulePosition positions[NUM_MODULES];
+};
+
+struct NvsModulePositions {
+    uint32_t layout;
+    ModulePosition positions[NUM_MODULES];
+};
+
+// Not initialized at boot, so whatever was here before a software reset is still here afterwards. After a power cycle
+// it's garbage, hence the magic and checksum.
+RTC_NOINIT_ATTR static RtcModulePositions rtc_module_positions;
+
+// FNV-1a
+static uint32_t checksum(const void* data, size_t length, uint32_t hash = 2166136261u) {
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ ((const uint8_t*)data)[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t checksum(const ModulePosition* positions) {
+    return checksum(positions, sizeof(ModulePosition) * NUM_MODULES);
+}
+
+// Identifies everything a saved position depends on: the record format, the number of modules, and the step geometry
+// of each spool variant (a position is a step count, and spool is an index into Spool::VARIANTS).
+static uint32_t layoutFingerprint() {
+    const uint32_t layout[] = {sizeof(ModulePosition), NUM_MODULES, HALF_STEP, Spool::NUM_SPOOL_VARIANTS};
+    uint32_t hash = checksum(layout, sizeof(layout));
+    for (uint8_t i = 0; i < Spool::NUM_SPOOL_VARIANTS; i++) {
+        const uint16_t geometry[] = {Spool::VARIANTS[i].num_flaps, Spool::VARIANTS[i].input_steps};
+        hash = checksum(geometry, sizeof(geometry), hash);
+    }
+    return hash;
+}
+
+ModulePositions::ModulePositions() : nvs_stale_(true) {
+    memset(positions_, INVALID, sizeof(positions_));
+}
+
+bool ModulePositions::load() {
+    Preferences p;
+    p.begin(MODULE_POSITIONS_PREFERENCES_NAMESPACE, true);
+    nvs_stale_ = p.getUChar(MODULE_POSITIONS_PREFERENCES_STALE_KEY, 1) != 0;
+
+    uint32_t layout = layoutFingerprint();
+    if (esp_reset_reason() != ESP_RST_POWERON && rtc_module_positions.magic == MODULE_POSITIONS_RTC_MAGIC &&
+            rtc_module_positions.layout == layout &&
+            rtc_module_positions.checksum == checksum(rtc_module_positions.positions)) {
+        p.end();
+        memcpy(positions_, rtc_module_positions.positions, sizeof(positions_));
+        return true;
+    }
+
+    NvsModulePositions saved;
+    size_t length = p.getBytes(MODULE_POSITIONS_PREFERENCES_KEY, &saved, sizeof(saved));
+    p.end();
+
+    // Ignore positions saved by firmware with a different layout, or that modules have moved on from since
+    if (nvs_stale_ || length != sizeof(saved) || saved.layout != layout) {
+        return false;
+    }
+    memcpy(positions_, saved.positions, sizeof(positions_));
+    return true;
+}
+
+bool ModulePositions::invalidate() {
+    rtc_module_positions.magic = 0;
+    if (nvs_stale_) {
+        return true;
+    }
+
+    Preferences p;
+    p.begin(MODULE_POSITIONS_PREFERENCES_NAMESPACE);
+    bool ok = p.putUChar(MODULE_POSITIONS_PREFERENCES_STALE_KEY, 1) == 1;
+    p.end();
+    nvs_stale_ = true;
+    return ok;
+}
+
+void ModulePositions::saveToRtc() {
+    memcpy(rtc_module_positions.positions, positions_, sizeof(positions_));
+    rtc_module_positions.layout = layoutFingerprint();
+    rtc_module_positions.checksum = checksum(positions_);
+    rtc_module_positions.magic = MODULE_POSITIONS_RTC_MAGIC;
+}
+
+bool ModulePositions::saveToNvs() {
+    NvsModulePositions saved;
+    saved.layout = layoutFingerprint();
+    memcpy(saved.positions, positions_, sizeof(saved.positions));
+
+    Preferences p;
+    p.begin(MODULE_POSITIONS_PREFERENCES_NAMESPACE);
+    bool ok = p.putBytes(MODULE_POSITIONS_PREFERENCES_KEY, &saved, sizeof(saved)) == sizeof(saved)
+        && p.putUChar(MODULE_POSITIONS_PREFERENCES_STALE_KEY, 0) == 1;
+    p.end();
+    nvs_stale_ = !ok;
+    return ok;
+}
@@ -0,0 +1,72 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+/**
+ * Where a module was resting, in its spool's frame of reference (see SplitflapModuleBank::RestorePosition). This is
+ * also the format stored in RTC memory and NVS. Both survive OTA updates, so saved positions are tagged with a
+ * fingerprint of this format and the spool geometry; positions saved by firmware with a different one are ignored
+ * (modules just home as usual).
+ */
+struct ModulePosition {
+    uint16_t step;
+    uint8_t target_flap_index;
+    // Spool::Variant the position was recorded with, or ModulePositions::INVALID
+    uint8_t spool;
+};
+
+/**
+ * Last known module positions, kept so that a reboot doesn't require homing every module.
+ *
+ * Positions are only meaningful while modules are at rest. They're kept in RTC memory, which survives software resets
+ * (OTA updates, crashes, brownouts) and is cheap to update, and in NVS to survive a power cycle. NVS writes wear the
+ * flash (and stall everything while they happen), so they're batched: the NVS copy is flagged stale once, just before
+ * modules start moving (rather than being rewritten on every move), and only rewritten once they've come to rest. Not thread-safe; only used by SplitflapTask.
+ */
+class ModulePositions {
+    public:
+        static const uint8_t INVALID = 0xFF;
+
+        // Starts with every position invalid
+        ModulePositions();
+
+        // Replaces positions with those in RTC memory if they survived the last reset, or failing that those in NVS,
+        // unless they were stale. Returns false if neither had valid positions.
+        bool load();
+
+        const ModulePosition& get(uint8_t module) const { return positions_[module]; }
+        void set(uint8_t module, const ModulePosition& position) { positions_[module] = position; }
+
+        // Records that modules are about to move, so the saved positions are stale until the next save. Call this while
+        // nothing is moving yet, as flagging the NVS copy writes to flash. Returns false if that failed.
+        bool invalidate();
+
+        // Saves the current positions, which must all be at rest. saveToRtc() is cheap enough to call whenever modules
+        // come to rest; saveToNvs() should be rate limited.
+        void saveToRtc();
+        bool saveToNvs();
+
+        // Whether the NVS copy is out of date
+        bool isNvsStale() const { return nvs_stale_; }
+
+    private:
+        ModulePosition positions_[NUM_MODULES];
+        bool nvs_stale_;
+};
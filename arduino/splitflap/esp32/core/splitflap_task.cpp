@@ -16,22 +16,64 @@
 #include <ctype.h>
 
 #include <esp_task_wdt.h>
+#include <Preferences.h>
 
 // General splitflap includes
 #include "config.h"
 #include "src/splitflap_module.h"
 #include "src/spi_io_config.h"
+#include "src/step_scheduler.h"
 
 // ESP32-specific includes
 #include "semaphore_guard.h"
 #include "task.h"
 #include "splitflap_task.h"
 
-static_assert(QCMD_FLAP + NUM_FLAPS <= 255, "Too many flaps to fit in uint8_t command structure");
+static_assert(QCMD_FLAP + Spool::MAX_NUM_FLAPS <= 255, "Too many flaps to fit in uint8_t command structure");
 
-SplitflapTask::SplitflapTask(const uint8_t task_core, const LedMode led_mode) : Task("Splitflap", 2048, 1, task_core), led_mode_(led_mode), state_semaphore_(xSemaphoreCreateMutex()) {
-  assert(state_semaphore_ != NULL);
-  xSemaphoreGive(state_semaphore_);
+// Only modules with a step due are updated each iteration; see step_scheduler.h
+static StepScheduler<NUM_MODULES> scheduler(module_bank);
+
+#if STEP_TIMER_ENGINE
+// The task runs once per tick, so it needs to preempt anything else on its core to keep the cadence
+#define SPLITFLAP_TASK_PRIORITY (configMAX_PRIORITIES - 2)
+
+// Hardware timer 0, prescaled from the 80MHz APB clock to 1MHz
+#define STEP_TIMER_INDEX 0
+#define STEP_TIMER_PRESCALER 80
+
+#define STEP_TIMER_STATS_INTERVAL_MILLIS 10000
+
+static hw_timer_t* step_timer = nullptr;
+static TaskHandle_t step_timer_task = nullptr;
+
+static void IRAM_ATTR onStepTimer() {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(step_timer_task, &higher_priority_task_woken);
+    if (higher_priority_task_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+#else
+#define SPLITFLAP_TASK_PRIORITY 1
+#endif
+
+#define HOME_CALIBRATION_PREFERENCES_NAMESPACE "homecal"
+#define HOME_CALIBRATION_PREFERENCES_KEY "modules"
+
+// Loopback test step at which a loopback output set at step 1 has come back in through the sensor chain
+#if ASYNC_MOTOR_SENSOR_IO
+#define LOOPBACK_VALIDATE_STEP 4
+#else
+#define LOOPBACK_VALIDATE_STEP 3
+#endif
+
+// Stack allows for NVS access when loading/saving home calibration and module positions
+SplitflapTask::SplitflapTask(const uint8_t task_core, const LedMode led_mode) : Task("Splitflap", 4096, SPLITFLAP_TASK_PRIORITY, task_core), led_mode_(led_mode), telemetry_semaphore_(xSemaphoreCreateMutex()), character_sets_semaphore_(xSemaphoreCreateMutex()) {
+  assert(telemetry_semaphore_ != NULL);
+  xSemaphoreGive(telemetry_semaphore_);
+  assert(character_sets_semaphore_ != NULL);
+  xSemaphoreGive(character_sets_semaphore_);
 
   queue_ = xQueueCreate(5, sizeof(Command));
   assert(queue_ != NULL);
@@ -41,12 +83,22 @@ SplitflapTask::~SplitflapTask() {
   if (queue_ != NULL) {
     vQueueDelete(queue_);
   }
-  if (state_semaphore_ != NULL) {
-    vSemaphoreDelete(state_semaphore_);
+  if (telemetry_semaphore_ != NULL) {
+    vSemaphoreDelete(telemetry_semaphore_);
+  }
+  if (character_sets_semaphore_ != NULL) {
+    vSemaphoreDelete(character_sets_semaphore_);
   }
 }
 
 
+/**
+ * MODIFY THIS to configure which Spool::Variant is fitted to each module!
+ */
+static uint8_t getSpoolForModuleIndex(uint8_t module_index) {
+    return Spool::SPOOL_DEFAULT;
+}
+
 void SplitflapTask::run() {
     esp_err_t result = esp_task_wdt_add(NULL);
     ESP_ERROR_CHECK(result);
@@ -67,9 +119,31 @@ void SplitflapTask::run() {
     bool loopback_off_result[NUM_LOOPBACKS];
     bool loopback_success = chainlink_test_all_loopbacks(loopback_result, loopback_off_result);
 
+#if CHAINLINK_DISCOVER_BOARDS
+    uint8_t boards;
+    if (chainlink_count_boards(loopback_result, loopback_off_result, &boards)) {
+      // Only the loopbacks on boards that are there need to pass
+      chainlink_num_loopbacks = min(boards * CHAINLINK_LOOPBACKS_PER_BOARD, NUM_LOOPBACKS);
+      num_modules_ = min(boards * CHAINLINK_MODULES_PER_BOARD, NUM_MODULES);
+      loopback_success = true;
+      for (uint8_t i = 0; i < chainlink_num_loopbacks; i++) {
+        loopback_success &= loopback_off_result[i];
+        for (uint8_t j = 0; j < chainlink_num_loopbacks; j++) {
+          loopback_success &= loopback_result[i][j];
+        }
+      }
+
+      char buffer[200] = {};
+      snprintf(buffer, sizeof(buffer), "Discovered %u driver boards (%u of up to %u modules)", boards, num_modules_, NUM_MODULES);
+      log(buffer);
+    } else {
+      log("Loopback ERROR. Found a driver board after a missing one");
+    }
+#endif
+
     if (!loopback_success) {
-      for (uint8_t i = 0; i < NUM_LOOPBACKS; i++) {
-        for (uint8_t j = 0; j < NUM_LOOPBACKS; j++) {
+      for (uint8_t i = 0; i < chainlink_num_loopbacks; i++) {
+        for (uint8_t j = 0; j < chainlink_num_loopbacks; j++) {
           if (!loopback_result[i][j]) {
             char buffer[200] = {};
             snprintf(buffer, sizeof(buffer), "Loopback ERROR. Set output %u but read incorrect value at input %u", i, j);
@@ -77,7 +151,7 @@ void SplitflapTask::run() {
           }
         }
       }
-      for (uint8_t j = 0; j < NUM_LOOPBACKS; j++) {
+      for (uint8_t j = 0; j < chainlink_num_loopbacks; j++) {
         if (!loopback_off_result[j]) {
             char buffer[200] = {};
             snprintf(buffer, sizeof(buffer), "Loopback ERROR. Loopback %u was set when all outputs off - should have been 0", j);
@@ -87,12 +161,13 @@ void SplitflapTask::run() {
 
       disableAll();
     }
+    loopback_pass_start_millis_ = millis();
 #else
     loopback_all_ok_ = true;
 #endif
 
     if (led_mode_ == LedMode::AUTO) {
-        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        for (uint8_t i = 0; i < num_modules_; i++) {
             chainlink_set_led(i, 1);
             motor_sensor_io();
             delay(10);
@@ -104,28 +179,247 @@ void SplitflapTask::run() {
     }
 #endif
 
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        modules[i]->SetSpool(getSpoolForModuleIndex(i));
+    }
+#if HOME_CALIBRATION_ENABLED
+    loadHomeCalibration();
+#endif
+    module_positions_.load();
+
+    uint8_t restored = 0;
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
         modules[i]->Init();
+        if (i >= num_modules_) {
+            // Not connected
+            modules[i]->Disable();
+            continue;
+        }
 #if !defined(CHAINLINK_DRIVER_TESTER) && !defined(CHAINLINK_BASE)
-        modules[i]->GoHome();
+        if (restoreModulePosition(i)) {
+            restored++;
+        } else {
+            modules[i]->GoHome();
+        }
 #endif
+        startModule(i, stepClockMicros());
+    }
+    if (restored > 0) {
+        char buffer[200] = {};
+        snprintf(buffer, sizeof(buffer), "Restored positions of %u modules", restored);
+        log(buffer);
     }
 
+#if STEP_TIMER_ENGINE
+    step_timer_task = xTaskGetCurrentTaskHandle();
+    step_timer = timerBegin(STEP_TIMER_INDEX, STEP_TIMER_PRESCALER, true);
+    timerAttachInterrupt(step_timer, &onStepTimer, true);
+    timerAlarmWrite(step_timer, STEP_TIMER_TICK_MICROS, true);
+    timerAlarmEnable(step_timer);
+    step_timer_stats_start_millis_ = millis();
+
+    while(1) {
+        // Exactly one update and one I/O frame per tick, unless idle
+        waitForStepTick();
+        processQueue(0);
+        if (!io_idle_ || millis() - last_update_millis_ >= IDLE_IO_INTERVAL_MILLIS) {
+            runUpdate();
+        }
+        recordStepTickDuration();
+        result = esp_task_wdt_reset();
+        ESP_ERROR_CHECK(result);
+    }
+#else
     while(1) {
-        processQueue();
+        // Nothing needs to happen until the next step is due (or a command arrives), so block rather than spinning
+        // if that's at least a couple of ticks away. Short waits spin, since tick granularity would add step jitter.
+        TickType_t ticks_to_wait = 1;
+        if (!scheduler.IsIdle()) {
+            ticks_to_wait = pdMS_TO_TICKS(scheduler.GetMicrosUntilNext(micros()) / 1000);
+            ticks_to_wait = ticks_to_wait > 1 ? ticks_to_wait - 1 : 0;
+        } else if (io_idle_) {
+            // A command cuts this short (and ends idle)
+            ticks_to_wait = pdMS_TO_TICKS(IDLE_IO_INTERVAL_MILLIS);
+        }
+        processQueue(ticks_to_wait);
         runUpdate();
         result = esp_task_wdt_reset();
         ESP_ERROR_CHECK(result);
     }
+#endif
 }
 
-void SplitflapTask::processQueue() {
-    if (xQueueReceive(queue_, &queue_receive_buffer_, 0) == pdTRUE) {
+unsigned long SplitflapTask::stepClockMicros() {
+#if STEP_TIMER_ENGINE
+    return step_clock_micros_;
+#else
+    return micros();
+#endif
+}
+
+#if STEP_TIMER_ENGINE
+void SplitflapTask::waitForStepTick() {
+    // Each notification is one timer tick; more than one pending means the previous iteration overran its tick
+    uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    step_tick_start_micros_ = micros();
+
+    step_clock_micros_ += ticks * STEP_TIMER_TICK_MICROS;
+    step_timer_ticks_ += ticks;
+    if (ticks > 1) {
+        step_timer_overruns_ += ticks - 1;
+    }
+}
+
+void SplitflapTask::recordStepTickDuration() {
+    uint32_t duration = micros() - step_tick_start_micros_;
+    if (duration > step_timer_max_tick_micros_) {
+        step_timer_max_tick_micros_ = duration;
+    }
+
+    uint32_t now = millis();
+    uint32_t elapsed = now - step_timer_stats_start_millis_;
+    if (elapsed >= STEP_TIMER_STATS_INTERVAL_MILLIS) {
+        char buffer[200] = {};
+        snprintf(buffer, sizeof(buffer), "Step timer: %u ticks/s (target %u), %u overruns, max tick %uus (budget %uus)",
+            step_timer_ticks_ * 1000 / elapsed,
+            1000000 / STEP_TIMER_TICK_MICROS,
+            step_timer_overruns_,
+            step_timer_max_tick_micros_,
+            STEP_TIMER_TICK_MICROS);
+        log(buffer);
+
+        step_timer_stats_start_millis_ = now;
+        step_timer_ticks_ = 0;
+        step_timer_overruns_ = 0;
+        step_timer_max_tick_micros_ = 0;
+    }
+}
+#endif
+
+#if IO_STATS_LOGGING
+void SplitflapTask::logIoStats() {
+    uint32_t now = millis();
+    uint32_t elapsed = now - io_stats_start_millis_;
+    if (elapsed < IO_STATS_INTERVAL_MILLIS) {
+        return;
+    }
+
+    uint32_t frames = motor_sensor_io_frames - io_stats_start_frames_;
+    uint32_t wait_micros = motor_sensor_io_wait_micros - io_stats_start_wait_micros_;
+    char buffer[200] = {};
+    snprintf(buffer, sizeof(buffer), "I/O: %u frames/s for %u modules on %u chains, %uus waiting per frame",
+        frames * 1000 / elapsed,
+        NUM_MODULES,
+        NUM_IO_CHAINS,
+        frames > 0 ? wait_micros / frames : 0);
+    log(buffer);
+
+    io_stats_start_millis_ = now;
+    io_stats_start_frames_ = motor_sensor_io_frames;
+    io_stats_start_wait_micros_ = motor_sensor_io_wait_micros;
+}
+#endif
+
+#if HOME_CALIBRATION_ENABLED
+void SplitflapTask::loadHomeCalibration() {
+    HomeCalibration calibration[NUM_MODULES];
+    Preferences p;
+    p.begin(HOME_CALIBRATION_PREFERENCES_NAMESPACE, true);
+    size_t length = p.getBytes(HOME_CALIBRATION_PREFERENCES_KEY, calibration, sizeof(calibration));
+    p.end();
+
+    // Ignore calibration saved for a different number of modules
+    if (length != sizeof(calibration)) {
+        return;
+    }
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        modules[i]->SetHomeCalibration(calibration[i]);
+    }
+    log("Loaded home calibration");
+}
+
+void SplitflapTask::saveHomeCalibration() {
+    HomeCalibration calibration[NUM_MODULES];
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        calibration[i] = modules[i]->GetHomeCalibration();
+    }
+    Preferences p;
+    p.begin(HOME_CALIBRATION_PREFERENCES_NAMESPACE);
+    if (p.putBytes(HOME_CALIBRATION_PREFERENCES_KEY, calibration, sizeof(calibration)) != sizeof(calibration)) {
+        log("Failed to save home calibration");
+    }
+    p.end();
+
+    saved_home_calibration_generation_ = module_bank.GetHomeCalibrationGeneration();
+    last_home_calibration_save_millis_ = millis();
+}
+#endif
+
+// Puts module i back at its position from before the last reset, if there's a valid one for it. Each saved position
+// is only used once.
+bool SplitflapTask::restoreModulePosition(uint8_t i) {
+    ModulePosition position = module_positions_.get(i);
+    module_positions_.set(i, {0, 0, ModulePositions::INVALID});
+    return position.spool == modules[i]->GetSpool() &&
+        modules[i]->RestorePosition(position.step, position.target_flap_index);
+}
+
+// Takes a snapshot of where every module is resting. Modules that aren't in a known position (e.g. failed to home)
+// are recorded as invalid, so they home after a reset.
+void SplitflapTask::recordModulePositions() {
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        ModulePosition position = {0, 0, ModulePositions::INVALID};
+        if (modules[i]->state == NORMAL && module_bank.IsParked(i)) {
+            position.step = modules[i]->GetCurrentStep();
+            position.target_flap_index = modules[i]->GetTargetFlapIndex();
+            position.spool = modules[i]->GetSpool();
+        }
+        module_positions_.set(i, position);
+    }
+    module_positions_.saveToRtc();
+    module_positions_unsaved_ = true;
+}
+
+void SplitflapTask::saveModulePositions() {
+    if (!module_positions_.saveToNvs()) {
+        log("Failed to save module positions");
+    }
+    module_positions_unsaved_ = false;
+    last_module_position_save_millis_ = millis();
+}
+
+// Whether any module's home sensor has changed since the last call, e.g. because someone is turning a spool by hand
+bool SplitflapTask::homeSensorsChanged() {
+    bool changed = false;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        bool home_state = modules[i]->GetHomeState();
+        changed |= home_state != last_home_state_[i];
+        last_home_state_[i] = home_state;
+    }
+    return changed;
+}
+
+// Called after every update's I/O frame. Anything but a display at rest with nothing changing returns to full rate
+// straight away; commands are handled in processQueue().
+void SplitflapTask::updateIoIdle(uint32_t now_millis) {
+    if (!all_stopped_ || homeSensorsChanged()) {
+        last_activity_millis_ = now_millis;
+    }
+    io_idle_ = all_stopped_ && IDLE_IO_INTERVAL_MILLIS > 0 && now_millis - last_activity_millis_ >= IDLE_IO_DELAY_MILLIS;
+}
+
+void SplitflapTask::processQueue(TickType_t ticks_to_wait) {
+    if (xQueueReceive(queue_, &queue_receive_buffer_, ticks_to_wait) == pdTRUE) {
+        last_activity_millis_ = millis();
+        io_idle_ = false;
+
+        unsigned long now = stepClockMicros();
         switch (queue_receive_buffer_.command_type) {
             case CommandType::MODULES: {
-                uint8_t* data = queue_receive_buffer_.data.module_command;
+                uint8_t* data = queue_receive_buffer_.data.module_commands.command;
+                uint8_t* motion_profile = queue_receive_buffer_.data.module_commands.motion_profile;
                 bool any_leds = false;
-                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                for (uint8_t i = 0; i < num_modules_; i++) {
                     switch (data[i]) {
                         case QCMD_NO_OP:
                             // No-op
@@ -133,6 +427,7 @@ void SplitflapTask::processQueue() {
                         case QCMD_RESET_AND_HOME:
                             modules[i]->ResetState();
                             modules[i]->GoHome();
+                            startModule(i, now);
                             break;
                         case QCMD_LED_ON:
                             any_leds = true;
@@ -150,8 +445,16 @@ void SplitflapTask::processQueue() {
                             modules[i]->Disable();
                             break;
                         default:
-                            assert(data[i] >= QCMD_FLAP && data[i] < QCMD_FLAP + NUM_FLAPS);
+                            assert(data[i] >= QCMD_FLAP);
+                            if (data[i] - QCMD_FLAP >= modules[i]->GetNumFlaps()) {
+                                char buffer[200] = {};
+                                snprintf(buffer, sizeof(buffer), "Invalid flap index (%u) specified for module %u", data[i] - QCMD_FLAP, i);
+                                log(buffer);
+                                break;
+                            }
+                            modules[i]->SetMotionProfile(motion_profile[i]);
                             modules[i]->GoToFlapIndex(data[i] - QCMD_FLAP);
+                            startModule(i, now);
                             break;
                     }
                 }
@@ -168,49 +471,132 @@ void SplitflapTask::processQueue() {
                 break;
             case CommandType::CONFIG: {
                 ModuleConfigs configs = queue_receive_buffer_.data.module_configs;
-                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                for (uint8_t i = 0; i < num_modules_; i++) {
                     ModuleConfig config = configs.config[i];
+                    modules[i]->SetMotionProfile(config.motion_profile);
 
                     if (config.reset_nonce != current_configs_.config[i].reset_nonce) {
                         modules[i]->ResetErrorCounters();
                         modules[i]->GoHome();
+                        startModule(i, now);
                     }
 
                     if (config.target_flap_index != current_configs_.config[i].target_flap_index ||
                             config.target_flap_index != modules[i]->GetTargetFlapIndex() ||
                             config.movement_nonce != current_configs_.config[i].movement_nonce) {
-                        if (config.target_flap_index >= NUM_FLAPS) {
+                        if (config.target_flap_index >= modules[i]->GetNumFlaps()) {
                             char buffer[200] = {};
                             snprintf(buffer, sizeof(buffer), "Invalid flap index (%u) specified for module %u", config.target_flap_index, i);
                             log(buffer);
                         } else {
                             modules[i]->GoToFlapIndex(config.target_flap_index);
+                            startModule(i, now);
                         }
                     }
                 }
                 current_configs_ = configs;
                 break;
             }
+            case CommandType::SEQUENCE: {
+                ModuleSequences& sequences = queue_receive_buffer_.data.module_sequences;
+                for (uint8_t i = 0; i < num_modules_; i++) {
+                    if (sequences.length[i] == 0) {
+                        continue;
+                    }
+                    modules[i]->SetDwellMillis(sequences.dwell_millis);
+                    for (uint8_t j = 0; j < sequences.length[i]; j++) {
+                        uint8_t flap_index = sequences.flap_index[i][j];
+                        if (flap_index >= modules[i]->GetNumFlaps()) {
+                            char buffer[200] = {};
+                            snprintf(buffer, sizeof(buffer), "Invalid flap index (%u) specified for module %u", flap_index, i);
+                            log(buffer);
+                        } else if (!modules[i]->QueueFlapIndex(flap_index)) {
+                            char buffer[200] = {};
+                            snprintf(buffer, sizeof(buffer), "Sequence queue full for module %u", i);
+                            log(buffer);
+                            break;
+                        }
+                    }
+                    startModule(i, now);
+                }
+                break;
+            }
+            case CommandType::RESTORE_OR_HOME: {
+                uint8_t restored = 0;
+                for (uint8_t i = 0; i < num_modules_; i++) {
+                    if (restoreModulePosition(i)) {
+                        restored++;
+                    } else {
+                        modules[i]->ResetState();
+                        modules[i]->GoHome();
+                        startModule(i, now);
+                    }
+                }
+                char buffer[200] = {};
+                snprintf(buffer, sizeof(buffer), "Restored positions of %u modules", restored);
+                log(buffer);
+                break;
+            }
         }
     }
 }
 
-void SplitflapTask::runUpdate() {
-    boolean all_idle = true;
+// Starts module i moving towards its (newly set) target, unless that would exceed its power channel's budget for
+// accelerating modules, in which case it waits for admitWaitingModules()
+void SplitflapTask::startModule(uint8_t i, unsigned long now) {
+    if (max_accelerating_per_channel_ == 0 || scheduler.IsScheduled(i)) {
+        // Unlimited, or already moving and therefore already admitted
+        scheduler.Wake(i, now);
+        return;
+    }
+    if (!awaiting_start_[i]) {
+        awaiting_start_[i] = true;
+        num_awaiting_start_++;
+    }
+}
+
+void SplitflapTask::admitWaitingModules(unsigned long now) {
+    if (num_awaiting_start_ == 0) {
+        return;
+    }
+
+    uint8_t accelerating[MAX_POWER_CHANNELS] = {};
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        if (scheduler.IsScheduled(i) && module_bank.IsAccelerating(i)) {
+            accelerating[power_channel_[i]]++;
+        }
+    }
 
+    for (uint8_t i = 0; i < NUM_MODULES && num_awaiting_start_ > 0; i++) {
+        uint8_t channel = power_channel_[i];
+        if (awaiting_start_[i] && accelerating[channel] < max_accelerating_per_channel_) {
+            awaiting_start_[i] = false;
+            num_awaiting_start_--;
+            accelerating[channel]++;
+            scheduler.Wake(i, now);
+        }
+    }
+}
+
+void SplitflapTask::runUpdate() {
     uint32_t iterationStartMillis = millis();
+    last_update_millis_ = iterationStartMillis;
 
     uint32_t flashStep = iterationStartMillis / 200;
     uint32_t flashGroup = (flashStep % 16) / 2;
     uint8_t flashPhase = flashStep % 2;
 
     if (sensor_test_ && all_stopped_) {
+      // Sensor test shows sensor changes as they happen, so never idles
+      last_activity_millis_ = iterationStartMillis;
+      io_idle_ = false;
+
       // Read sensor state
       motor_sensor_io();
 
 #ifdef CHAINLINK
       if (led_mode_ == LedMode::AUTO) {
-        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        for (uint8_t i = 0; i < num_modules_; i++) {
           chainlink_set_led(i, modules[i]->GetHomeState());
         }
         // Output LED state
@@ -218,82 +604,132 @@ void SplitflapTask::runUpdate() {
       }
 #endif
     } else {
-      all_stopped_ = true;
-      for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        modules[i]->Update();
-        bool is_idle = modules[i]->state == PANIC
-          || modules[i]->state == STATE_DISABLED
-          || modules[i]->state == LOOK_FOR_HOME
-          || modules[i]->state == SENSOR_ERROR
-          || (modules[i]->state == NORMAL && modules[i]->current_accel_step == 0);
-
-        bool is_stopped = modules[i]->state == PANIC
-          || modules[i]->state == STATE_DISABLED
-          || modules[i]->current_accel_step == 0;
+      // Saved positions are only valid while modules are at rest. Flag them stale when modules are given something to
+      // do, before the first step: writing to flash stalls everything, which is harmless only while nothing is moving.
+      if (all_stopped_ && (!scheduler.IsIdle() || num_awaiting_start_ > 0)) {
+          if (!module_positions_.invalidate()) {
+              log("Failed to invalidate module positions");
+          }
+      }
+
+      unsigned long now = stepClockMicros();
+      admitWaitingModules(now);
+      scheduler.Update(now);
+
+      // Parked modules are always stopped, and scheduled ones are only momentarily at zero speed (starting a move), so
+      // this is close enough to checking every module's accel step without touching every module.
+      bool was_stopped = all_stopped_;
+      all_stopped_ = scheduler.IsIdle() && num_awaiting_start_ == 0;
+
+      // RTC memory is updated as soon as modules stop; NVS once they've stayed stopped for a while.
+      if (!was_stopped && all_stopped_) {
+          recordModulePositions();
+          all_stopped_millis_ = iterationStartMillis;
+      }
+      if (all_stopped_ && module_positions_unsaved_ &&
+              iterationStartMillis - all_stopped_millis_ >= MODULE_POSITION_SAVE_DELAY_MILLIS &&
+              iterationStartMillis - last_module_position_save_millis_ >= MODULE_POSITION_SAVE_INTERVAL_MILLIS) {
+          saveModulePositions();
+      }
+
+#if HOME_CALIBRATION_ENABLED
+      // Writing to flash stalls everything, so only save while nothing is moving
+      if (all_stopped_ && module_bank.GetHomeCalibrationGeneration() != saved_home_calibration_generation_ &&
+              iterationStartMillis - last_home_calibration_save_millis_ >= HOME_CALIBRATION_SAVE_INTERVAL_MILLIS) {
+          saveHomeCalibration();
+      }
+#endif
 
 #ifdef CHAINLINK
-        if (led_mode_ == LedMode::AUTO) {
+      // LED state only changes with the flash pattern (or a module's state, which is at most 200ms stale here)
+      if (led_mode_ == LedMode::AUTO && flashStep != last_flash_step_) {
+        last_flash_step_ = flashStep;
+        for (uint8_t i = 0; i < num_modules_; i++) {
           chainlink_set_led(i, flashGroup < modules[i]->state && flashPhase == 0);
         }
-#endif
-
-        all_idle &= is_idle;
-        all_stopped_ &= is_stopped;
       }
-      motor_sensor_io();
+#endif
+      motor_sensor_io_pipelined();
+      updateIoIdle(iterationStartMillis);
     }
 
 
 #if defined(CHAINLINK) && CHAINLINK_ENFORCE_LOOPBACKS
     // We test loopbacks iteratively, so as not to waste too many cycles/IO-roundtrips all at once. There are
     // two levels of iteration - loopback_step_index_ tracks the small intermediate steps of testing a single
-    // loopback, and loopback_current_out_index_ tracks which loopback we're currently testing.
+    // loopback (or pattern), and loopback_current_out_index_ tracks which loopback (or pattern) we're currently testing.
+    // A loopback output takes 2 frames to show up, or 3 if I/O is pipelined (see chainlink_validate_loopback).
     loopback_step_index_++;
+#if CHAINLINK_BINARY_LOOPBACK_CHECK
+    // Each pattern covers every loopback, so there's no need to space them out
     if (loopback_step_index_ == 1) {
-      chainlink_set_loopback(loopback_current_out_index_);
-    } else if (loopback_step_index_ == 3) {
-      bool ok = chainlink_validate_loopback(loopback_current_out_index_, nullptr);
-      loopback_current_ok_ &= ok;
+      chainlink_set_loopback_pattern(loopback_current_out_index_);
+    } else if (loopback_step_index_ == LOOPBACK_VALIDATE_STEP) {
+      checkLoopback(chainlink_validate_loopback_pattern(loopback_current_out_index_));
 
-      if (!ok && loopback_all_ok_) {
-        // Publish failures immediately
-        loopback_all_ok_ = false;
-        log("Loopback ERROR!");
-        disableAll();
+      loopback_step_index_ = 0;
+      loopback_current_out_index_ += 1;
+      if (loopback_current_out_index_ >= chainlink_loopback_pattern_count()) {
+        finishLoopbackPass();
       }
+    }
+#else
+    if (loopback_step_index_ == 1) {
+      chainlink_set_loopback(loopback_current_out_index_);
+    } else if (loopback_step_index_ == LOOPBACK_VALIDATE_STEP) {
+      checkLoopback(chainlink_validate_loopback(loopback_current_out_index_, nullptr));
     } else if (loopback_step_index_ == 50) {
       loopback_step_index_ = 0;
       loopback_current_out_index_ += 1;
-
-      // If we've iterated through all loopbacks, save the results of this run and restart
-      // from the first loopback again.
-      if (loopback_current_out_index_ >= NUM_LOOPBACKS) {
-        if (loopback_current_ok_ && !loopback_all_ok_) {
-            log("Loopback is ok!");
-        }
-        loopback_all_ok_ = loopback_current_ok_;
-        loopback_current_ok_ = true;
-        loopback_current_out_index_ = 0;
+      if (loopback_current_out_index_ >= chainlink_num_loopbacks) {
+        finishLoopbackPass();
       }
     }
+#endif
     // TODO: handle loopback failures
 #endif
 
+#if IO_STATS_LOGGING
+    logIoStats();
+#endif
+
     updateStateCache();
+    updateTelemetryCache();
 }
 
-int8_t SplitflapTask::findFlapIndex(uint8_t character) {
-    for (int8_t i = 0; i < NUM_FLAPS; i++) {
-        if (tolower(character) == flaps[i]) {
-          return i;
-        }
+#if defined(CHAINLINK) && CHAINLINK_ENFORCE_LOOPBACKS
+void SplitflapTask::checkLoopback(bool ok) {
+    loopback_current_ok_ &= ok;
+
+    if (!ok && loopback_all_ok_) {
+        // Publish failures immediately
+        loopback_all_ok_ = false;
+        log("Loopback ERROR!");
+        disableAll();
     }
-    return -1;
 }
 
+// Every loopback has been checked: save the results of this pass and start again from the first loopback. A fault is
+// found within one pass of it appearing, so the time a pass takes is the worst-case detection latency.
+void SplitflapTask::finishLoopbackPass() {
+    if (loopback_current_ok_ && !loopback_all_ok_) {
+        log("Loopback is ok!");
+    }
+    loopback_all_ok_ = loopback_current_ok_;
+    loopback_current_ok_ = true;
+    loopback_current_out_index_ = 0;
+
+    uint32_t now = millis();
+    loopback_pass_millis_ = now - loopback_pass_start_millis_;
+    loopback_pass_start_millis_ = now;
+}
+#endif
+
 void SplitflapTask::updateStateCache() {
-    SplitflapState new_state;
+    // Zeroed (padding included), as changes are found with memcmp
+    SplitflapState new_state = {};
     new_state.mode = sensor_test_ ? SplitflapMode::MODE_SENSOR_TEST : SplitflapMode::MODE_RUN;
+    new_state.num_modules = num_modules_;
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
       new_state.modules[i].flap_index = modules[i]->GetCurrentFlapIndex();
       new_state.modules[i].state = modules[i]->state;
@@ -306,10 +742,56 @@ void SplitflapTask::updateStateCache() {
 #ifdef CHAINLINK
     new_state.loopbacks_ok = loopback_all_ok_;
 #endif
-    if (memcmp(&state_cache_, &new_state, sizeof(state_cache_))) {
-        SemaphoreGuard lock(state_semaphore_);
-        memcpy(&state_cache_, &new_state, sizeof(state_cache_));
+    uint32_t sequence = state_sequence_.load(std::memory_order_relaxed);
+    if (memcmp(&state_cache_[sequence / 2 % 2], &new_state, sizeof(new_state)) == 0) {
+        return;
     }
+
+    // Write the other buffer, marking the sequence odd first so any reader still copying it (from two generations
+    // ago) knows to retry, then publish it
+    state_sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&state_cache_[(sequence / 2 + 1) % 2], &new_state, sizeof(new_state));
+    state_sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+void SplitflapTask::updateTelemetryCache() {
+    uint32_t now = millis();
+    uint32_t elapsed = now - io_rate_start_millis_;
+    bool changed = io_idle_ != telemetry_cache_.io_idle;
+#if defined(CHAINLINK) && CHAINLINK_ENFORCE_LOOPBACKS
+    changed |= loopback_pass_millis_ != telemetry_cache_.loopback_check_millis;
+#endif
+    if (elapsed >= 1000) {
+        io_frames_per_second_ = (motor_sensor_io_frames - io_rate_start_frames_) * 1000 / elapsed;
+        io_rate_start_millis_ = now;
+        io_rate_start_frames_ = motor_sensor_io_frames;
+        changed |= io_frames_per_second_ != telemetry_cache_.io_frames_per_second;
+    }
+
+#if HOME_ERROR_TELEMETRY_ENABLED
+    uint16_t generation = module_bank.GetHomeErrorTelemetryGeneration();
+    bool home_errors_changed = generation != telemetry_cache_generation_;
+    telemetry_cache_generation_ = generation;
+    changed |= home_errors_changed;
+#endif
+    if (!changed) {
+        return;
+    }
+
+    SemaphoreGuard lock(telemetry_semaphore_);
+    telemetry_cache_.io_frames_per_second = io_frames_per_second_;
+    telemetry_cache_.io_idle = io_idle_;
+#if defined(CHAINLINK) && CHAINLINK_ENFORCE_LOOPBACKS
+    telemetry_cache_.loopback_check_millis = loopback_pass_millis_;
+#endif
+#if HOME_ERROR_TELEMETRY_ENABLED
+    if (home_errors_changed) {
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            telemetry_cache_.modules[i] = modules[i]->GetHomeErrorTelemetry();
+        }
+    }
+#endif
 }
 
 void SplitflapTask::log(const char* msg) {
@@ -321,31 +803,62 @@ void SplitflapTask::log(const char* msg) {
 void SplitflapTask::showString(const char* str, uint8_t length, bool force_full_rotation) {
     Command command = {};
     command.command_type = CommandType::MODULES;
-    for (uint8_t i = 0; i < length; i++) {
-        int8_t index = findFlapIndex(str[REVERSE_STRING ? length - i - 1 : i]);
-        if (index != -1) {
-            if (force_full_rotation || index != modules[i]->GetTargetFlapIndex()) {
-                command.data.module_command[i] = QCMD_FLAP + index;
+    {
+        SemaphoreGuard lock(character_sets_semaphore_);
+        for (uint8_t i = 0; i < length; i++) {
+            uint8_t index = character_sets_.findFlapIndex(i, str[REVERSE_STRING ? length - i - 1 : i]);
+            if (index != CharacterSets::NOT_FOUND) {
+                if (force_full_rotation || index != modules[i]->GetTargetFlapIndex()) {
+                    command.data.module_commands.command[i] = QCMD_FLAP + index;
+                }
             }
         }
     }
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
 
+void SplitflapTask::loadCharacterSets() {
+    SemaphoreGuard lock(character_sets_semaphore_);
+    character_sets_.load();
+}
+
+bool SplitflapTask::setCharacterSets(const CharacterSetConfig& config) {
+    SemaphoreGuard lock(character_sets_semaphore_);
+    if (!character_sets_.set(config)) {
+        log("Invalid character sets");
+        return false;
+    }
+    if (!character_sets_.save()) {
+        log("Failed to save character sets");
+    }
+    return true;
+}
+
+uint8_t SplitflapTask::getFlapCharacter(uint8_t module, uint8_t flap_index) {
+    SemaphoreGuard lock(character_sets_semaphore_);
+    return character_sets_.getFlapCharacter(module, flap_index);
+}
+
 void SplitflapTask::resetAll() {
     Command command = {};
     command.command_type = CommandType::MODULES;
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        command.data.module_command[i] = QCMD_RESET_AND_HOME;
+        command.data.module_commands.command[i] = QCMD_RESET_AND_HOME;
     }
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
 
+void SplitflapTask::restorePositionsOrHomeAll() {
+    Command command = {};
+    command.command_type = CommandType::RESTORE_OR_HOME;
+    assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
+}
+
 void SplitflapTask::disableAll() {
     Command command = {};
     command.command_type = CommandType::MODULES;
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        command.data.module_command[i] = QCMD_DISABLE;
+        command.data.module_commands.command[i] = QCMD_DISABLE;
     }
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
@@ -355,7 +868,7 @@ void SplitflapTask::setLed(const uint8_t id, const bool on) {
 
     Command command = {};
     command.command_type = CommandType::MODULES;
-    command.data.module_command[id] = on ? QCMD_LED_ON : QCMD_LED_OFF;
+    command.data.module_commands.command[id] = on ? QCMD_LED_ON : QCMD_LED_OFF;
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
 
@@ -365,15 +878,45 @@ void SplitflapTask::setSensorTest(bool sensor_test) {
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
 
-SplitflapState SplitflapTask::getState() {
-    SemaphoreGuard lock(state_semaphore_);
-    return state_cache_;
+SplitflapState SplitflapTask::getState(uint32_t* generation) {
+    SplitflapState state;
+    while (true) {
+        uint32_t sequence = state_sequence_.load(std::memory_order_acquire);
+        memcpy(&state, &state_cache_[sequence / 2 % 2], sizeof(state));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // The buffer just copied is only overwritten once the writer starts on the generation after next, which makes
+        // the sequence more than 2 past the (even) one it was published at. Otherwise the copy is good.
+        if (state_sequence_.load(std::memory_order_relaxed) - (sequence & ~1u) <= 2) {
+            if (generation != nullptr) {
+                *generation = sequence / 2;
+            }
+            return state;
+        }
+    }
+}
+
+uint32_t SplitflapTask::getStateGeneration() {
+    return state_sequence_.load(std::memory_order_acquire) / 2;
+}
+
+SplitflapTelemetry SplitflapTask::getTelemetry() {
+    SemaphoreGuard lock(telemetry_semaphore_);
+    return telemetry_cache_;
 }
 
 void SplitflapTask::setLogger(Logger* logger) {
     logger_ = logger;
 }
 
+void SplitflapTask::setPowerChannels(uint8_t (*power_channel_for_module)(uint8_t), uint8_t max_accelerating_per_channel) {
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        power_channel_[i] = power_channel_for_module(i);
+        assert(power_channel_[i] < MAX_POWER_CHANNELS);
+    }
+    max_accelerating_per_channel_ = max_accelerating_per_channel;
+}
+
 void SplitflapTask::postRawCommand(Command command) {
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
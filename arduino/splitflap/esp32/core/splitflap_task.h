@@ -15,12 +15,60 @@
 */
 #pragma once
 
+#include <atomic>
+
 #include "config.h"
+#include "character_sets.h"
 #include "logger.h"
+#include "module_positions.h"
 #include "src/splitflap_module_data.h"
 
 #include "task.h"
 
+#ifndef STEP_TIMER_ENGINE
+#define STEP_TIMER_ENGINE false
+#endif
+
+// Tick period of the hardware-timer stepping engine. Each tick performs one update pass and one I/O frame, so this
+// needs to leave enough time for the SPI transfer of the full chain.
+#ifndef STEP_TIMER_TICK_MICROS
+#define STEP_TIMER_TICK_MICROS 250
+#endif
+
+// Periodically log motor/sensor I/O throughput (see motor_sensor_io_frames)
+#ifndef IO_STATS_LOGGING
+#define IO_STATS_LOGGING false
+#endif
+#define IO_STATS_INTERVAL_MILLIS 10000
+
+// Once everything has been stopped this long, with no commands or home sensor changes, I/O drops to one frame every
+// IDLE_IO_INTERVAL_MILLIS (just enough for LEDs, loopback checks and noticing a module being turned by hand), leaving
+// the CPU and SPI bus to other tasks. Set IDLE_IO_INTERVAL_MILLIS to 0 to always run at full rate.
+#ifndef IDLE_IO_DELAY_MILLIS
+#define IDLE_IO_DELAY_MILLIS 1000
+#endif
+#ifndef IDLE_IO_INTERVAL_MILLIS
+#define IDLE_IO_INTERVAL_MILLIS 20
+#endif
+
+// Maximum number of power channels that module starts can be budgeted across (see SplitflapTask::setPowerChannels)
+#define MAX_POWER_CHANNELS 8
+
+// Minimum time between saves of learned home calibration to NVS, to limit flash wear
+#ifndef HOME_CALIBRATION_SAVE_INTERVAL_MILLIS
+#define HOME_CALIBRATION_SAVE_INTERVAL_MILLIS (10 * 60 * 1000)
+#endif
+
+// Module positions are saved to NVS once modules have been at rest this long, so a burst of moves is saved only once
+#ifndef MODULE_POSITION_SAVE_DELAY_MILLIS
+#define MODULE_POSITION_SAVE_DELAY_MILLIS 5000
+#endif
+
+// Minimum time between saves of module positions to NVS, to limit flash wear
+#ifndef MODULE_POSITION_SAVE_INTERVAL_MILLIS
+#define MODULE_POSITION_SAVE_INTERVAL_MILLIS (60 * 1000)
+#endif
+
 enum class SplitflapMode {
     MODE_RUN,
     MODE_SENSOR_TEST,
@@ -50,6 +98,9 @@ struct SplitflapModuleState {
 
 struct SplitflapState {
     SplitflapMode mode;
+    // Number of modules connected; entries beyond this are disabled. Less than NUM_MODULES only if the chain is
+    // shorter than configured (see CHAINLINK_DISCOVER_BOARDS).
+    uint8_t num_modules;
     SplitflapModuleState modules[NUM_MODULES];
 
 #ifdef CHAINLINK
@@ -64,6 +115,7 @@ struct SplitflapState {
         }
 
         return mode == other.mode
+            && num_modules == other.num_modules
 #ifdef CHAINLINK
             && loopbacks_ok == other.loopbacks_ok
 #endif
@@ -75,6 +127,20 @@ struct SplitflapState {
     }
 };
 
+struct SplitflapTelemetry {
+#if HOME_ERROR_TELEMETRY_ENABLED
+    HomeErrorTelemetry modules[NUM_MODULES];
+#endif
+
+    // Motor/sensor I/O frames over the last second, and whether I/O is at the idle rate (see IDLE_IO_DELAY_MILLIS)
+    uint16_t io_frames_per_second;
+    bool io_idle;
+
+    // Time the last pass over every Chainlink loopback took, i.e. the worst-case time to detect a loopback fault (see
+    // CHAINLINK_BINARY_LOOPBACK_CHECK). 0 until a pass has completed, or without Chainlink.
+    uint32_t loopback_check_millis;
+};
+
 enum class LedMode {
     AUTO,
     MANUAL,
@@ -85,23 +151,39 @@ enum class CommandType {
     SENSOR_TEST_SET,
     SENSOR_TEST_CLEAR,
     CONFIG,
+    SEQUENCE,
+    RESTORE_OR_HOME,
 };
 
 struct ModuleConfig {
     uint8_t target_flap_index;
     uint8_t movement_nonce;
     uint8_t reset_nonce;
+    uint8_t motion_profile;
 };
 
 struct ModuleConfigs {
     ModuleConfig config[NUM_MODULES];
 };
 
+struct ModuleCommands {
+    uint8_t command[NUM_MODULES];
+    // Acceleration::Profile to use for a QCMD_FLAP movement
+    uint8_t motion_profile[NUM_MODULES];
+};
+
+struct ModuleSequences {
+    uint8_t flap_index[NUM_MODULES][TARGET_QUEUE_LENGTH];
+    uint8_t length[NUM_MODULES];
+    uint16_t dwell_millis;
+};
+
 struct Command {
     CommandType command_type;
     union CommandData {
-        uint8_t module_command[NUM_MODULES];
+        ModuleCommands module_commands;
         ModuleConfigs module_configs;
+        ModuleSequences module_sequences;
     };
     CommandData data;
 };
@@ -120,47 +202,153 @@ class SplitflapTask : public Task<SplitflapTask> {
         SplitflapTask(const uint8_t task_core, const LedMode led_mode);
         ~SplitflapTask();
         
-        SplitflapState getState();
+        // Latest state, and optionally its generation. Never blocks the splitflap task.
+        SplitflapState getState(uint32_t* generation = nullptr);
+
+        // Incremented whenever the state changes (starting from 0, for an all-zero SplitflapState). Cheap to poll, so
+        // callers can skip copying the state when it's the same generation as the copy they already have.
+        uint32_t getStateGeneration();
+
+        SplitflapTelemetry getTelemetry();
 
         void showString(const char *str, uint8_t length, bool force_full_rotation = FORCE_FULL_ROTATION);
         void resetAll();
+        // Puts modules back where they were before the last reset, if known (see ModulePositions), and homes the rest.
+        // For setups that don't home at boot (e.g. waiting for power to be enabled first).
+        void restorePositionsOrHomeAll();
         void disableAll();
         void setLed(uint8_t id, bool on);
         void setSensorTest(bool sensor_test);
         void setLogger(Logger* logger);
         void postRawCommand(Command command);
 
+        // Limits how many modules on each power channel may be accelerating at once, to keep inrush current within
+        // what the supply (and supervisor) expects. Further moves are held back until a module on the same channel
+        // reaches cruising speed or stops. Must be called before begin().
+        void setPowerChannels(uint8_t (*power_channel_for_module)(uint8_t), uint8_t max_accelerating_per_channel);
+
+        // Character sets used by showString(); see CharacterSets. Sets are saved to NVS when changed, and
+        // loadCharacterSets() restores them (call it from setup(), as NVS isn't available before then).
+        void loadCharacterSets();
+        bool setCharacterSets(const CharacterSetConfig& config);
+        uint8_t getFlapCharacter(uint8_t module, uint8_t flap_index);
+
     protected:
         void run();
 
     private:
         const LedMode led_mode_;
-        const SemaphoreHandle_t state_semaphore_;
+        const SemaphoreHandle_t telemetry_semaphore_;
+        const SemaphoreHandle_t character_sets_semaphore_;
         QueueHandle_t queue_;
         Command queue_receive_buffer_ = {};
         Logger* logger_;
 
+        // Modules actually connected; the rest of the NUM_MODULES are left disabled
+        uint8_t num_modules_ = NUM_MODULES;
+
         bool all_stopped_ = true;
+        uint32_t last_flash_step_ = UINT32_MAX;
 
         uint32_t last_sensor_print_millis_ = 0;
         bool sensor_test_ = SENSOR_TEST;
         ModuleConfigs current_configs_ = {};
 
+        // Protected by character_sets_semaphore_
+        CharacterSets character_sets_;
+
+        // Admission control; see setPowerChannels(). A limit of 0 disables it.
+        uint8_t power_channel_[NUM_MODULES] = {};
+        uint8_t max_accelerating_per_channel_ = 0;
+        bool awaiting_start_[NUM_MODULES] = {};
+        uint8_t num_awaiting_start_ = 0;
+
+#if HOME_CALIBRATION_ENABLED
+        // See SplitflapModuleBank::GetHomeCalibrationGeneration()
+        uint16_t saved_home_calibration_generation_ = 0;
+        uint32_t last_home_calibration_save_millis_ = 0;
+#endif
+
+        // Positions loaded at boot are consumed by restoreModulePosition(); afterwards, this holds the positions last
+        // saved.
+        ModulePositions module_positions_;
+        bool module_positions_unsaved_ = false;
+        uint32_t all_stopped_millis_ = 0;
+        uint32_t last_module_position_save_millis_ = 0;
+
+        // Adaptive I/O rate; see IDLE_IO_DELAY_MILLIS
+        uint32_t last_activity_millis_ = 0;
+        uint32_t last_update_millis_ = 0;
+        bool last_home_state_[NUM_MODULES] = {};
+        bool io_idle_ = false;
+        uint32_t io_rate_start_millis_ = 0;
+        uint32_t io_rate_start_frames_ = 0;
+        uint16_t io_frames_per_second_ = 0;
+
 #ifdef CHAINLINK
         uint8_t loopback_current_out_index_ = 0;
         uint16_t loopback_step_index_ = 0;
         bool loopback_current_ok_ = true;
         bool loopback_all_ok_ = false;
+        uint32_t loopback_pass_start_millis_ = 0;
+        uint32_t loopback_pass_millis_ = 0;
 #endif
 
-        // Cached state. Protected by state_semaphore_
-        SplitflapState state_cache_;
+        // Cached state, published without locking (a seqlock over two buffers), so readers never block this task:
+        // state_cache_[generation % 2] holds the latest state, and state_sequence_ is twice its generation, plus one
+        // while the other buffer is being written. See getState().
+        SplitflapState state_cache_[2] = {};
+        std::atomic<uint32_t> state_sequence_ = {0};
         void updateStateCache();
 
-        void processQueue();
+        // Cached telemetry, only copied out when it changes (i.e. SplitflapModuleBank::GetHomeErrorTelemetryGeneration()
+        // or the I/O rate). Protected by telemetry_semaphore_
+        SplitflapTelemetry telemetry_cache_ = {};
+#if HOME_ERROR_TELEMETRY_ENABLED
+        uint16_t telemetry_cache_generation_ = 0;
+#endif
+        void updateTelemetryCache();
+
+#if STEP_TIMER_ENGINE
+        // Step clock, advanced by STEP_TIMER_TICK_MICROS on every timer tick
+        unsigned long step_clock_micros_ = 0;
+
+        // Instrumentation, reset every time it's logged
+        uint32_t step_tick_start_micros_ = 0;
+        uint32_t step_timer_stats_start_millis_ = 0;
+        uint32_t step_timer_ticks_ = 0;
+        uint32_t step_timer_overruns_ = 0;
+        uint32_t step_timer_max_tick_micros_ = 0;
+
+        void waitForStepTick();
+        void recordStepTickDuration();
+#endif
+#if IO_STATS_LOGGING
+        uint32_t io_stats_start_millis_ = 0;
+        uint32_t io_stats_start_frames_ = 0;
+        uint32_t io_stats_start_wait_micros_ = 0;
+
+        void logIoStats();
+#endif
+        unsigned long stepClockMicros();
+
+        void processQueue(TickType_t ticks_to_wait);
+        void startModule(uint8_t i, unsigned long now);
+        void admitWaitingModules(unsigned long now);
         void runUpdate();
+#if HOME_CALIBRATION_ENABLED
+        void loadHomeCalibration();
+        void saveHomeCalibration();
+#endif
+        bool restoreModulePosition(uint8_t i);
+        void recordModulePositions();
+        void saveModulePositions();
+        bool homeSensorsChanged();
+        void updateIoIdle(uint32_t now_millis);
+#if defined(CHAINLINK) && CHAINLINK_ENFORCE_LOOPBACKS
+        void checkLoopback(bool ok);
+        void finishLoopbackPass();
+#endif
         void sensorTestUpdate();
         void log(const char* msg);
-
-        int8_t findFlapIndex(uint8_t character);
 };
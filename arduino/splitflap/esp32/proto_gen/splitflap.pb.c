@@ -27,6 +27,12 @@ PB_BIND(PB_SupervisorState_PowerChannelState, PB_SupervisorState_PowerChannelSta
 PB_BIND(PB_SupervisorState_FaultInfo, PB_SupervisorState_FaultInfo, 2)
 
 
+PB_BIND(PB_SplitflapTelemetry, PB_SplitflapTelemetry, 4)
+
+
+PB_BIND(PB_SplitflapTelemetry_ModuleTelemetry, PB_SplitflapTelemetry_ModuleTelemetry, AUTO)
+
+
 PB_BIND(PB_FromSplitflap, PB_FromSplitflap, 4)
 
 
@@ -42,9 +48,24 @@ PB_BIND(PB_SplitflapConfig, PB_SplitflapConfig, 2)
 PB_BIND(PB_SplitflapConfig_ModuleConfig, PB_SplitflapConfig_ModuleConfig, AUTO)
 
 
+PB_BIND(PB_SplitflapSequence, PB_SplitflapSequence, 2)
+
+
+PB_BIND(PB_SplitflapSequence_ModuleSequence, PB_SplitflapSequence_ModuleSequence, AUTO)
+
+
+PB_BIND(PB_SplitflapCharacterSets, PB_SplitflapCharacterSets, 2)
+
+
+PB_BIND(PB_SplitflapCharacterSets_CharacterSet, PB_SplitflapCharacterSets_CharacterSet, AUTO)
+
+
 PB_BIND(PB_RequestState, PB_RequestState, AUTO)
 
 
+PB_BIND(PB_RequestTelemetry, PB_RequestTelemetry, AUTO)
+
+
 PB_BIND(PB_ToSplitflap, PB_ToSplitflap, 2)
 
 
@@ -10,6 +10,13 @@
 #endif
 
 /* Enum definitions */
+typedef enum _PB_MotionProfile { 
+    PB_MotionProfile_MOTION_PROFILE_DEFAULT = 0, 
+    PB_MotionProfile_MOTION_PROFILE_QUIET = 1, 
+    PB_MotionProfile_MOTION_PROFILE_S_CURVE = 2, 
+    PB_MotionProfile_MOTION_PROFILE_S_CURVE_FAST = 3 
+} PB_MotionProfile;
+
 typedef enum _PB_SplitflapState_ModuleState_State { 
     PB_SplitflapState_ModuleState_State_NORMAL = 0, 
     PB_SplitflapState_ModuleState_State_LOOK_FOR_HOME = 1, 
@@ -48,6 +55,10 @@ typedef struct _PB_RequestState {
     char dummy_field;
 } PB_RequestState;
 
+typedef struct _PB_RequestTelemetry { 
+    char dummy_field;
+} PB_RequestTelemetry;
+
 typedef struct _PB_Ack { 
     uint32_t nonce; 
 } PB_Ack;
@@ -56,17 +67,29 @@ typedef struct _PB_Log {
     char msg[256]; 
 } PB_Log;
 
+typedef PB_BYTES_ARRAY_T(52) PB_SplitflapCharacterSets_CharacterSet_flaps_t;
+typedef struct _PB_SplitflapCharacterSets_CharacterSet { 
+    PB_SplitflapCharacterSets_CharacterSet_flaps_t flaps; 
+} PB_SplitflapCharacterSets_CharacterSet;
+
 typedef struct _PB_SplitflapCommand_ModuleCommand { 
     PB_SplitflapCommand_ModuleCommand_Action action; 
     uint8_t param; 
+    PB_MotionProfile motion_profile; 
 } PB_SplitflapCommand_ModuleCommand;
 
 typedef struct _PB_SplitflapConfig_ModuleConfig { 
     uint8_t target_flap_index; 
     uint8_t movement_nonce; 
     uint8_t reset_nonce; 
+    PB_MotionProfile motion_profile; 
 } PB_SplitflapConfig_ModuleConfig;
 
+typedef PB_BYTES_ARRAY_T(8) PB_SplitflapSequence_ModuleSequence_flap_indices_t;
+typedef struct _PB_SplitflapSequence_ModuleSequence { 
+    PB_SplitflapSequence_ModuleSequence_flap_indices_t flap_indices; 
+} PB_SplitflapSequence_ModuleSequence;
+
 typedef struct _PB_SplitflapState_ModuleState { 
     PB_SplitflapState_ModuleState_State state; 
     uint8_t flap_index; 
@@ -76,6 +99,13 @@ typedef struct _PB_SplitflapState_ModuleState {
     uint8_t count_missed_home; 
 } PB_SplitflapState_ModuleState;
 
+typedef struct _PB_SplitflapTelemetry_ModuleTelemetry { 
+    pb_size_t home_error_histogram_count;
+    uint16_t home_error_histogram[7]; 
+    uint32_t recoveries; 
+    uint32_t millis_since_last_error; 
+} PB_SplitflapTelemetry_ModuleTelemetry;
+
 typedef struct _PB_SupervisorState_FaultInfo { 
     PB_SupervisorState_FaultInfo_FaultType type; 
     char msg[256]; 
@@ -88,6 +118,13 @@ typedef struct _PB_SupervisorState_PowerChannelState {
     bool on; 
 } PB_SupervisorState_PowerChannelState;
 
+typedef PB_BYTES_ARRAY_T(255) PB_SplitflapCharacterSets_module_character_sets_t;
+typedef struct _PB_SplitflapCharacterSets { 
+    pb_size_t character_sets_count;
+    PB_SplitflapCharacterSets_CharacterSet character_sets[4]; 
+    PB_SplitflapCharacterSets_module_character_sets_t module_character_sets; 
+} PB_SplitflapCharacterSets;
+
 typedef struct _PB_SplitflapCommand { 
     pb_size_t modules_count;
     PB_SplitflapCommand_ModuleCommand modules[255]; 
@@ -98,11 +135,25 @@ typedef struct _PB_SplitflapConfig {
     PB_SplitflapConfig_ModuleConfig modules[255]; 
 } PB_SplitflapConfig;
 
+typedef struct _PB_SplitflapSequence { 
+    pb_size_t modules_count;
+    PB_SplitflapSequence_ModuleSequence modules[255]; 
+    uint32_t dwell_millis; 
+} PB_SplitflapSequence;
+
 typedef struct _PB_SplitflapState { 
     pb_size_t modules_count;
     PB_SplitflapState_ModuleState modules[255]; 
 } PB_SplitflapState;
 
+typedef struct _PB_SplitflapTelemetry { 
+    pb_size_t modules_count;
+    PB_SplitflapTelemetry_ModuleTelemetry modules[255]; 
+    uint32_t io_frames_per_second; 
+    bool io_idle; 
+    uint32_t loopback_check_millis; 
+} PB_SplitflapTelemetry;
+
 typedef struct _PB_SupervisorState { 
     uint32_t uptime_millis; 
     PB_SupervisorState_State state; 
@@ -119,6 +170,7 @@ typedef struct _PB_FromSplitflap {
         PB_Log log;
         PB_Ack ack;
         PB_SupervisorState supervisor_state;
+        PB_SplitflapTelemetry splitflap_telemetry;
     } payload; 
 } PB_FromSplitflap;
 
@@ -129,11 +181,18 @@ typedef struct _PB_ToSplitflap {
         PB_SplitflapCommand splitflap_command;
         PB_SplitflapConfig splitflap_config;
         PB_RequestState request_state;
+        PB_SplitflapSequence splitflap_sequence;
+        PB_SplitflapCharacterSets splitflap_character_sets;
+        PB_RequestTelemetry request_telemetry;
     } payload; 
 } PB_ToSplitflap;
 
 
 /* Helper constants for enums */
+#define _PB_MotionProfile_MIN PB_MotionProfile_MOTION_PROFILE_DEFAULT
+#define _PB_MotionProfile_MAX PB_MotionProfile_MOTION_PROFILE_S_CURVE_FAST
+#define _PB_MotionProfile_ARRAYSIZE ((PB_MotionProfile)(PB_MotionProfile_MOTION_PROFILE_S_CURVE_FAST+1))
+
 #define _PB_SplitflapState_ModuleState_State_MIN PB_SplitflapState_ModuleState_State_NORMAL
 #define _PB_SplitflapState_ModuleState_State_MAX PB_SplitflapState_ModuleState_State_STATE_DISABLED
 #define _PB_SplitflapState_ModuleState_State_ARRAYSIZE ((PB_SplitflapState_ModuleState_State)(PB_SplitflapState_ModuleState_State_STATE_DISABLED+1))
@@ -163,12 +222,19 @@ extern "C" {
 #define PB_SupervisorState_init_default          {0, _PB_SupervisorState_State_MIN, 0, {PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default}, false, PB_SupervisorState_FaultInfo_init_default}
 #define PB_SupervisorState_PowerChannelState_init_default {0, 0, 0}
 #define PB_SupervisorState_FaultInfo_init_default {_PB_SupervisorState_FaultInfo_FaultType_MIN, "", 0}
+#define PB_SplitflapTelemetry_init_default       {0, {PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default, PB_SplitflapTelemetry_ModuleTelemetry_init_default}, 0, 0, 0}
+#define PB_SplitflapTelemetry_ModuleTelemetry_init_default {0, {0, 0, 0, 0, 0, 0, 0}, 0, 0}
 #define PB_FromSplitflap_init_default            {0, {PB_SplitflapState_init_default}}
 #define PB_SplitflapCommand_init_default         {0, {PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default}}
-#define PB_SplitflapCommand_ModuleCommand_init_default {_PB_SplitflapCommand_ModuleCommand_Action_MIN, 0}
+#define PB_SplitflapCommand_ModuleCommand_init_default {_PB_SplitflapCommand_ModuleCommand_Action_MIN, 0, _PB_MotionProfile_MIN}
 #define PB_SplitflapConfig_init_default          {0, {PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default}}
-#define PB_SplitflapConfig_ModuleConfig_init_default {0, 0, 0}
+#define PB_SplitflapConfig_ModuleConfig_init_default {0, 0, 0, _PB_MotionProfile_MIN}
+#define PB_SplitflapSequence_init_default        {0, {PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default, PB_SplitflapSequence_ModuleSequence_init_default}, 0}
+#define PB_SplitflapSequence_ModuleSequence_init_default {{0, {0}}}
+#define PB_SplitflapCharacterSets_init_default   {0, {PB_SplitflapCharacterSets_CharacterSet_init_default, PB_SplitflapCharacterSets_CharacterSet_init_default, PB_SplitflapCharacterSets_CharacterSet_init_default, PB_SplitflapCharacterSets_CharacterSet_init_default}, {0, {0}}}
+#define PB_SplitflapCharacterSets_CharacterSet_init_default {{0, {0}}}
 #define PB_RequestState_init_default             {0}
+#define PB_RequestTelemetry_init_default         {0}
 #define PB_ToSplitflap_init_default              {0, 0, {PB_SplitflapCommand_init_default}}
 #define PB_SplitflapState_init_zero              {0, {PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero}}
 #define PB_SplitflapState_ModuleState_init_zero  {_PB_SplitflapState_ModuleState_State_MIN, 0, 0, 0, 0, 0}
@@ -177,37 +243,59 @@ extern "C" {
 #define PB_SupervisorState_init_zero             {0, _PB_SupervisorState_State_MIN, 0, {PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero}, false, PB_SupervisorState_FaultInfo_init_zero}
 #define PB_SupervisorState_PowerChannelState_init_zero {0, 0, 0}
 #define PB_SupervisorState_FaultInfo_init_zero   {_PB_SupervisorState_FaultInfo_FaultType_MIN, "", 0}
+#define PB_SplitflapTelemetry_init_zero          {0, {PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero, PB_SplitflapTelemetry_ModuleTelemetry_init_zero}, 0, 0, 0}
+#define PB_SplitflapTelemetry_ModuleTelemetry_init_zero {0, {0, 0, 0, 0, 0, 0, 0}, 0, 0}
 #define PB_FromSplitflap_init_zero               {0, {PB_SplitflapState_init_zero}}
 #define PB_SplitflapCommand_init_zero            {0, {PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero}}
-#define PB_SplitflapCommand_ModuleCommand_init_zero {_PB_SplitflapCommand_ModuleCommand_Action_MIN, 0}
+#define PB_SplitflapCommand_ModuleCommand_init_zero {_PB_SplitflapCommand_ModuleCommand_Action_MIN, 0, _PB_MotionProfile_MIN}
 #define PB_SplitflapConfig_init_zero             {0, {PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero}}
-#define PB_SplitflapConfig_ModuleConfig_init_zero {0, 0, 0}
+#define PB_SplitflapConfig_ModuleConfig_init_zero {0, 0, 0, _PB_MotionProfile_MIN}
+#define PB_SplitflapSequence_init_zero           {0, {PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero, PB_SplitflapSequence_ModuleSequence_init_zero}, 0}
+#define PB_SplitflapSequence_ModuleSequence_init_zero {{0, {0}}}
+#define PB_SplitflapCharacterSets_init_zero      {0, {PB_SplitflapCharacterSets_CharacterSet_init_zero, PB_SplitflapCharacterSets_CharacterSet_init_zero, PB_SplitflapCharacterSets_CharacterSet_init_zero, PB_SplitflapCharacterSets_CharacterSet_init_zero}, {0, {0}}}
+#define PB_SplitflapCharacterSets_CharacterSet_init_zero {{0, {0}}}
 #define PB_RequestState_init_zero                {0}
+#define PB_RequestTelemetry_init_zero            {0}
 #define PB_ToSplitflap_init_zero                 {0, 0, {PB_SplitflapCommand_init_zero}}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define PB_Ack_nonce_tag                         1
 #define PB_Log_msg_tag                           1
+#define PB_SplitflapCharacterSets_CharacterSet_flaps_tag 1
 #define PB_SplitflapCommand_ModuleCommand_action_tag 1
 #define PB_SplitflapCommand_ModuleCommand_param_tag 2
+#define PB_SplitflapCommand_ModuleCommand_motion_profile_tag 3
 #define PB_SplitflapConfig_ModuleConfig_target_flap_index_tag 1
 #define PB_SplitflapConfig_ModuleConfig_movement_nonce_tag 2
 #define PB_SplitflapConfig_ModuleConfig_reset_nonce_tag 3
+#define PB_SplitflapConfig_ModuleConfig_motion_profile_tag 4
+#define PB_SplitflapSequence_ModuleSequence_flap_indices_tag 1
 #define PB_SplitflapState_ModuleState_state_tag  1
 #define PB_SplitflapState_ModuleState_flap_index_tag 2
 #define PB_SplitflapState_ModuleState_moving_tag 3
 #define PB_SplitflapState_ModuleState_home_state_tag 4
 #define PB_SplitflapState_ModuleState_count_unexpected_home_tag 5
 #define PB_SplitflapState_ModuleState_count_missed_home_tag 6
+#define PB_SplitflapTelemetry_ModuleTelemetry_home_error_histogram_tag 1
+#define PB_SplitflapTelemetry_ModuleTelemetry_recoveries_tag 2
+#define PB_SplitflapTelemetry_ModuleTelemetry_millis_since_last_error_tag 3
 #define PB_SupervisorState_FaultInfo_type_tag    1
 #define PB_SupervisorState_FaultInfo_msg_tag     2
 #define PB_SupervisorState_FaultInfo_ts_millis_tag 3
 #define PB_SupervisorState_PowerChannelState_voltage_volts_tag 1
 #define PB_SupervisorState_PowerChannelState_current_amps_tag 2
 #define PB_SupervisorState_PowerChannelState_on_tag 3
+#define PB_SplitflapCharacterSets_character_sets_tag 1
+#define PB_SplitflapCharacterSets_module_character_sets_tag 2
 #define PB_SplitflapCommand_modules_tag          2
 #define PB_SplitflapConfig_modules_tag           1
+#define PB_SplitflapSequence_modules_tag         1
+#define PB_SplitflapSequence_dwell_millis_tag    2
 #define PB_SplitflapState_modules_tag            1
+#define PB_SplitflapTelemetry_modules_tag        1
+#define PB_SplitflapTelemetry_io_frames_per_second_tag 2
+#define PB_SplitflapTelemetry_io_idle_tag        3
+#define PB_SplitflapTelemetry_loopback_check_millis_tag 4
 #define PB_SupervisorState_uptime_millis_tag     1
 #define PB_SupervisorState_state_tag             2
 #define PB_SupervisorState_power_channels_tag    3
@@ -216,10 +304,14 @@ extern "C" {
 #define PB_FromSplitflap_log_tag                 2
 #define PB_FromSplitflap_ack_tag                 3
 #define PB_FromSplitflap_supervisor_state_tag    4
+#define PB_FromSplitflap_splitflap_telemetry_tag 5
 #define PB_ToSplitflap_nonce_tag                 1
 #define PB_ToSplitflap_splitflap_command_tag     2
 #define PB_ToSplitflap_splitflap_config_tag      3
 #define PB_ToSplitflap_request_state_tag         4
+#define PB_ToSplitflap_splitflap_sequence_tag    5
+#define PB_ToSplitflap_splitflap_character_sets_tag 6
+#define PB_ToSplitflap_request_telemetry_tag     7
 
 /* Struct field encoding specification for nanopb */
 #define PB_SplitflapState_FIELDLIST(X, a) \
@@ -272,17 +364,35 @@ X(a, STATIC,   SINGULAR, UINT32,   ts_millis,         3)
 #define PB_SupervisorState_FaultInfo_CALLBACK NULL
 #define PB_SupervisorState_FaultInfo_DEFAULT NULL
 
+#define PB_SplitflapTelemetry_FIELDLIST(X, a) \
+X(a, STATIC,   REPEATED, MESSAGE,  modules,           1) \
+X(a, STATIC,   SINGULAR, UINT32,   io_frames_per_second,   2) \
+X(a, STATIC,   SINGULAR, BOOL,     io_idle,           3) \
+X(a, STATIC,   SINGULAR, UINT32,   loopback_check_millis,   4)
+#define PB_SplitflapTelemetry_CALLBACK NULL
+#define PB_SplitflapTelemetry_DEFAULT NULL
+#define PB_SplitflapTelemetry_modules_MSGTYPE PB_SplitflapTelemetry_ModuleTelemetry
+
+#define PB_SplitflapTelemetry_ModuleTelemetry_FIELDLIST(X, a) \
+X(a, STATIC,   REPEATED, UINT32,   home_error_histogram,   1) \
+X(a, STATIC,   SINGULAR, UINT32,   recoveries,        2) \
+X(a, STATIC,   SINGULAR, UINT32,   millis_since_last_error,   3)
+#define PB_SplitflapTelemetry_ModuleTelemetry_CALLBACK NULL
+#define PB_SplitflapTelemetry_ModuleTelemetry_DEFAULT NULL
+
 #define PB_FromSplitflap_FIELDLIST(X, a) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_state,payload.splitflap_state),   1) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,log,payload.log),   2) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,ack,payload.ack),   3) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,supervisor_state,payload.supervisor_state),   4)
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,supervisor_state,payload.supervisor_state),   4) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_telemetry,payload.splitflap_telemetry),   5)
 #define PB_FromSplitflap_CALLBACK NULL
 #define PB_FromSplitflap_DEFAULT NULL
 #define PB_FromSplitflap_payload_splitflap_state_MSGTYPE PB_SplitflapState
 #define PB_FromSplitflap_payload_log_MSGTYPE PB_Log
 #define PB_FromSplitflap_payload_ack_MSGTYPE PB_Ack
 #define PB_FromSplitflap_payload_supervisor_state_MSGTYPE PB_SupervisorState
+#define PB_FromSplitflap_payload_splitflap_telemetry_MSGTYPE PB_SplitflapTelemetry
 
 #define PB_SplitflapCommand_FIELDLIST(X, a) \
 X(a, STATIC,   REPEATED, MESSAGE,  modules,           2)
@@ -292,7 +402,8 @@ X(a, STATIC,   REPEATED, MESSAGE,  modules,           2)
 
 #define PB_SplitflapCommand_ModuleCommand_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UENUM,    action,            1) \
-X(a, STATIC,   SINGULAR, UINT32,   param,             2)
+X(a, STATIC,   SINGULAR, UINT32,   param,             2) \
+X(a, STATIC,   SINGULAR, UENUM,    motion_profile,    3)
 #define PB_SplitflapCommand_ModuleCommand_CALLBACK NULL
 #define PB_SplitflapCommand_ModuleCommand_DEFAULT NULL
 
@@ -305,25 +416,61 @@ X(a, STATIC,   REPEATED, MESSAGE,  modules,           1)
 #define PB_SplitflapConfig_ModuleConfig_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UINT32,   target_flap_index,   1) \
 X(a, STATIC,   SINGULAR, UINT32,   movement_nonce,    2) \
-X(a, STATIC,   SINGULAR, UINT32,   reset_nonce,       3)
+X(a, STATIC,   SINGULAR, UINT32,   reset_nonce,       3) \
+X(a, STATIC,   SINGULAR, UENUM,    motion_profile,    4)
 #define PB_SplitflapConfig_ModuleConfig_CALLBACK NULL
 #define PB_SplitflapConfig_ModuleConfig_DEFAULT NULL
 
+#define PB_SplitflapSequence_FIELDLIST(X, a) \
+X(a, STATIC,   REPEATED, MESSAGE,  modules,           1) \
+X(a, STATIC,   SINGULAR, UINT32,   dwell_millis,      2)
+#define PB_SplitflapSequence_CALLBACK NULL
+#define PB_SplitflapSequence_DEFAULT NULL
+#define PB_SplitflapSequence_modules_MSGTYPE PB_SplitflapSequence_ModuleSequence
+
+#define PB_SplitflapSequence_ModuleSequence_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, BYTES,    flap_indices,      1)
+#define PB_SplitflapSequence_ModuleSequence_CALLBACK NULL
+#define PB_SplitflapSequence_ModuleSequence_DEFAULT NULL
+
+#define PB_SplitflapCharacterSets_FIELDLIST(X, a) \
+X(a, STATIC,   REPEATED, MESSAGE,  character_sets,    1) \
+X(a, STATIC,   SINGULAR, BYTES,    module_character_sets,   2)
+#define PB_SplitflapCharacterSets_CALLBACK NULL
+#define PB_SplitflapCharacterSets_DEFAULT NULL
+#define PB_SplitflapCharacterSets_character_sets_MSGTYPE PB_SplitflapCharacterSets_CharacterSet
+
+#define PB_SplitflapCharacterSets_CharacterSet_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, BYTES,    flaps,             1)
+#define PB_SplitflapCharacterSets_CharacterSet_CALLBACK NULL
+#define PB_SplitflapCharacterSets_CharacterSet_DEFAULT NULL
+
 #define PB_RequestState_FIELDLIST(X, a) \
 
 #define PB_RequestState_CALLBACK NULL
 #define PB_RequestState_DEFAULT NULL
 
+#define PB_RequestTelemetry_FIELDLIST(X, a) \
+
+#define PB_RequestTelemetry_CALLBACK NULL
+#define PB_RequestTelemetry_DEFAULT NULL
+
 #define PB_ToSplitflap_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UINT32,   nonce,             1) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_command,payload.splitflap_command),   2) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_config,payload.splitflap_config),   3) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,request_state,payload.request_state),   4)
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,request_state,payload.request_state),   4) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_sequence,payload.splitflap_sequence),   5) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_character_sets,payload.splitflap_character_sets),   6) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,request_telemetry,payload.request_telemetry),   7)
 #define PB_ToSplitflap_CALLBACK NULL
 #define PB_ToSplitflap_DEFAULT NULL
 #define PB_ToSplitflap_payload_splitflap_command_MSGTYPE PB_SplitflapCommand
 #define PB_ToSplitflap_payload_splitflap_config_MSGTYPE PB_SplitflapConfig
 #define PB_ToSplitflap_payload_request_state_MSGTYPE PB_RequestState
+#define PB_ToSplitflap_payload_splitflap_sequence_MSGTYPE PB_SplitflapSequence
+#define PB_ToSplitflap_payload_splitflap_character_sets_MSGTYPE PB_SplitflapCharacterSets
+#define PB_ToSplitflap_payload_request_telemetry_MSGTYPE PB_RequestTelemetry
 
 extern const pb_msgdesc_t PB_SplitflapState_msg;
 extern const pb_msgdesc_t PB_SplitflapState_ModuleState_msg;
@@ -332,12 +479,19 @@ extern const pb_msgdesc_t PB_Ack_msg;
 extern const pb_msgdesc_t PB_SupervisorState_msg;
 extern const pb_msgdesc_t PB_SupervisorState_PowerChannelState_msg;
 extern const pb_msgdesc_t PB_SupervisorState_FaultInfo_msg;
+extern const pb_msgdesc_t PB_SplitflapTelemetry_msg;
+extern const pb_msgdesc_t PB_SplitflapTelemetry_ModuleTelemetry_msg;
 extern const pb_msgdesc_t PB_FromSplitflap_msg;
 extern const pb_msgdesc_t PB_SplitflapCommand_msg;
 extern const pb_msgdesc_t PB_SplitflapCommand_ModuleCommand_msg;
 extern const pb_msgdesc_t PB_SplitflapConfig_msg;
 extern const pb_msgdesc_t PB_SplitflapConfig_ModuleConfig_msg;
+extern const pb_msgdesc_t PB_SplitflapSequence_msg;
+extern const pb_msgdesc_t PB_SplitflapSequence_ModuleSequence_msg;
+extern const pb_msgdesc_t PB_SplitflapCharacterSets_msg;
+extern const pb_msgdesc_t PB_SplitflapCharacterSets_CharacterSet_msg;
 extern const pb_msgdesc_t PB_RequestState_msg;
+extern const pb_msgdesc_t PB_RequestTelemetry_msg;
 extern const pb_msgdesc_t PB_ToSplitflap_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
@@ -348,29 +502,43 @@ extern const pb_msgdesc_t PB_ToSplitflap_msg;
 #define PB_SupervisorState_fields &PB_SupervisorState_msg
 #define PB_SupervisorState_PowerChannelState_fields &PB_SupervisorState_PowerChannelState_msg
 #define PB_SupervisorState_FaultInfo_fields &PB_SupervisorState_FaultInfo_msg
+#define PB_SplitflapTelemetry_fields &PB_SplitflapTelemetry_msg
+#define PB_SplitflapTelemetry_ModuleTelemetry_fields &PB_SplitflapTelemetry_ModuleTelemetry_msg
 #define PB_FromSplitflap_fields &PB_FromSplitflap_msg
 #define PB_SplitflapCommand_fields &PB_SplitflapCommand_msg
 #define PB_SplitflapCommand_ModuleCommand_fields &PB_SplitflapCommand_ModuleCommand_msg
 #define PB_SplitflapConfig_fields &PB_SplitflapConfig_msg
 #define PB_SplitflapConfig_ModuleConfig_fields &PB_SplitflapConfig_ModuleConfig_msg
+#define PB_SplitflapSequence_fields &PB_SplitflapSequence_msg
+#define PB_SplitflapSequence_ModuleSequence_fields &PB_SplitflapSequence_ModuleSequence_msg
+#define PB_SplitflapCharacterSets_fields &PB_SplitflapCharacterSets_msg
+#define PB_SplitflapCharacterSets_CharacterSet_fields &PB_SplitflapCharacterSets_CharacterSet_msg
 #define PB_RequestState_fields &PB_RequestState_msg
+#define PB_RequestTelemetry_fields &PB_RequestTelemetry_msg
 #define PB_ToSplitflap_fields &PB_ToSplitflap_msg
 
 /* Maximum encoded size of messages (where known) */
 #define PB_Ack_size                              6
-#define PB_FromSplitflap_size                    4338
+#define PB_FromSplitflap_size                    9452
 #define PB_Log_size                              258
 #define PB_RequestState_size                     0
-#define PB_SplitflapCommand_ModuleCommand_size   5
-#define PB_SplitflapCommand_size                 1785
-#define PB_SplitflapConfig_ModuleConfig_size     9
-#define PB_SplitflapConfig_size                  2805
+#define PB_RequestTelemetry_size                 0
+#define PB_SplitflapCharacterSets_CharacterSet_size 54
+#define PB_SplitflapCharacterSets_size           482
+#define PB_SplitflapCommand_ModuleCommand_size   7
+#define PB_SplitflapCommand_size                 2295
+#define PB_SplitflapConfig_ModuleConfig_size     11
+#define PB_SplitflapConfig_size                  3315
+#define PB_SplitflapSequence_ModuleSequence_size 10
+#define PB_SplitflapSequence_size                3066
 #define PB_SplitflapState_ModuleState_size       15
 #define PB_SplitflapState_size                   4335
+#define PB_SplitflapTelemetry_ModuleTelemetry_size 35
+#define PB_SplitflapTelemetry_size               9449
 #define PB_SupervisorState_FaultInfo_size        266
 #define PB_SupervisorState_PowerChannelState_size 12
 #define PB_SupervisorState_size                  347
-#define PB_ToSplitflap_size                      2814
+#define PB_ToSplitflap_size                      3324
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -66,10 +66,15 @@ void DisplayTask::run() {
 
     uint8_t module_row, module_col;
     int32_t module_x, module_y;
+    SplitflapState state = {};
     SplitflapState last_state = {};
+    uint32_t last_state_generation = 0;
     String last_messages[countof(messages_)] = {};
     while(1) {
-        SplitflapState state = splitflap_task_.getState();
+        // Only copy the state when the splitflap task has published a new one
+        if (splitflap_task_.getStateGeneration() != last_state_generation) {
+            state = splitflap_task_.getState(&last_state_generation);
+        }
         if (state != last_state) {
             tft_.setTextSize(module_text_size);
             for (uint8_t i = 0; i < NUM_MODULES; i++) {
@@ -86,7 +91,7 @@ void DisplayTask::run() {
                 char c;
                 switch (s.state) {
                     case NORMAL:
-                        c = flaps[s.flap_index];
+                        c = splitflap_task_.getFlapCharacter(i, s.flap_index);
                         if (s.moving) {
                             // use a dimmer color when moving
                             foreground = 0x6b4d;
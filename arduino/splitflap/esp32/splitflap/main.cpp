@@ -29,9 +29,8 @@
 SplitflapTask splitflapTask(1, LedMode::AUTO);
 SerialTask serialTask(splitflapTask, 0);
 
-#if ENABLE_DISPLAY
+// Always constructed, as the clock posts messages to it, but only started (and so only takes over VSPI) with the display
 DisplayTask displayTask(splitflapTask, 0);
-#endif
 
 #if ENABLE_OTA
 OtaTask otaTask(serialTask, 0);
@@ -42,6 +41,7 @@ ClockTask clockTask(splitflapTask, displayTask, serialTask, 1);
 void setup() {
   serialTask.begin();
 
+  splitflapTask.loadCharacterSets();
   splitflapTask.begin();
 
   #if ENABLE_DISPLAY
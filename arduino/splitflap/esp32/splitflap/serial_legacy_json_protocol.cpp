@@ -148,7 +148,7 @@ void SerialLegacyJsonProtocol::dumpStatus(const SplitflapState& state) {
                 break;
         }
         stream_.print("\", \"flap\":\"");
-        stream_.write(flaps[state.modules[i].flap_index]);
+        stream_.write(splitflap_task_.getFlapCharacter(i, state.modules[i].flap_index));
         stream_.print("\", \"count_missed_home\":");
         stream_.print(state.modules[i].count_missed_home);
         stream_.print(", \"count_unexpected_home\":");
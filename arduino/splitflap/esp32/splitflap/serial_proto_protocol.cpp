@@ -82,8 +82,9 @@ void SerialProtoProtocol::loop() {
         state_requested_ = false;
         pb_tx_buffer_ = {};
         pb_tx_buffer_.which_payload = PB_FromSplitflap_splitflap_state_tag;
-        pb_tx_buffer_.payload.splitflap_state.modules_count = NUM_MODULES;
-        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        // Only the modules actually connected (see SplitflapState::num_modules)
+        pb_tx_buffer_.payload.splitflap_state.modules_count = latest_state_.num_modules;
+        for (uint8_t i = 0; i < latest_state_.num_modules; i++) {
             pb_tx_buffer_.payload.splitflap_state.modules[i] = {
                 .state = (PB_SplitflapState_ModuleState_State) latest_state_.modules[i].state,
                 .flap_index = latest_state_.modules[i].flap_index,
@@ -99,6 +100,33 @@ void SerialProtoProtocol::loop() {
         last_sent_state_ = latest_state_;
         last_sent_state_millis_ = millis();
     }
+
+    if (telemetry_requested_) {
+        telemetry_requested_ = false;
+        sendTelemetry();
+    }
+}
+
+void SerialProtoProtocol::sendTelemetry() {
+    pb_tx_buffer_ = {};
+    pb_tx_buffer_.which_payload = PB_FromSplitflap_splitflap_telemetry_tag;
+    SplitflapTelemetry telemetry = splitflap_task_.getTelemetry();
+    pb_tx_buffer_.payload.splitflap_telemetry.io_frames_per_second = telemetry.io_frames_per_second;
+    pb_tx_buffer_.payload.splitflap_telemetry.io_idle = telemetry.io_idle;
+    pb_tx_buffer_.payload.splitflap_telemetry.loopback_check_millis = telemetry.loopback_check_millis;
+#if HOME_ERROR_TELEMETRY_ENABLED
+    uint32_t now = millis();
+    pb_tx_buffer_.payload.splitflap_telemetry.modules_count = latest_state_.num_modules;
+    for (uint8_t i = 0; i < latest_state_.num_modules; i++) {
+        const HomeErrorTelemetry& module_telemetry = telemetry.modules[i];
+        PB_SplitflapTelemetry_ModuleTelemetry& pb_module = pb_tx_buffer_.payload.splitflap_telemetry.modules[i];
+        pb_module.home_error_histogram_count = HOME_ERROR_HISTOGRAM_BINS;
+        memcpy(pb_module.home_error_histogram, module_telemetry.histogram, sizeof(pb_module.home_error_histogram));
+        pb_module.recoveries = module_telemetry.recoveries;
+        pb_module.millis_since_last_error = module_telemetry.recoveries > 0 ? now - module_telemetry.last_error_millis : 0;
+    }
+#endif
+    sendPbTxBuffer();
 }
 
 void SerialProtoProtocol::handlePacket(const uint8_t* buffer, size_t size) {
@@ -151,14 +179,15 @@ void SerialProtoProtocol::handlePacket(const uint8_t* buffer, size_t size) {
             for (uint8_t i = 0; i < min((int)command.modules_count, NUM_MODULES); i++) {
                 switch (command.modules[i].action) {
                     case PB_SplitflapCommand_ModuleCommand_Action_NO_OP:
-                        c.data.module_command[i] = QCMD_NO_OP;
+                        c.data.module_commands.command[i] = QCMD_NO_OP;
                         break;
                     case PB_SplitflapCommand_ModuleCommand_Action_RESET_AND_HOME:
-                        c.data.module_command[i] = QCMD_RESET_AND_HOME;
+                        c.data.module_commands.command[i] = QCMD_RESET_AND_HOME;
                         break;
                     case PB_SplitflapCommand_ModuleCommand_Action_GO_TO_FLAP:
                         if (command.modules[i].param <= 255 - QCMD_FLAP) {
-                            c.data.module_command[i] = QCMD_FLAP + command.modules[i].param;
+                            c.data.module_commands.command[i] = QCMD_FLAP + command.modules[i].param;
+                            c.data.module_commands.motion_profile[i] = command.modules[i].motion_profile;
                         }
                         break;
                     default:
@@ -178,13 +207,46 @@ void SerialProtoProtocol::handlePacket(const uint8_t* buffer, size_t size) {
                 module_config.target_flap_index = config.modules[i].target_flap_index;
                 module_config.movement_nonce = config.modules[i].movement_nonce;
                 module_config.reset_nonce = config.modules[i].reset_nonce;
+                module_config.motion_profile = config.modules[i].motion_profile;
+            }
+            splitflap_task_.postRawCommand(c);
+            break;
+        }
+        case PB_ToSplitflap_splitflap_sequence_tag: {
+            const PB_SplitflapSequence& sequence = pb_rx_buffer_.payload.splitflap_sequence;
+            Command c = {};
+            c.command_type = CommandType::SEQUENCE;
+            c.data.module_sequences.dwell_millis = min(sequence.dwell_millis, (uint32_t)UINT16_MAX);
+            for (uint8_t i = 0; i < min((int)sequence.modules_count, NUM_MODULES); i++) {
+                const PB_SplitflapSequence_ModuleSequence_flap_indices_t& flap_indices = sequence.modules[i].flap_indices;
+                uint8_t length = min((int)flap_indices.size, TARGET_QUEUE_LENGTH);
+                memcpy(c.data.module_sequences.flap_index[i], flap_indices.bytes, length);
+                c.data.module_sequences.length[i] = length;
             }
             splitflap_task_.postRawCommand(c);
             break;
         }
+        case PB_ToSplitflap_splitflap_character_sets_tag: {
+            const PB_SplitflapCharacterSets& character_sets = pb_rx_buffer_.payload.splitflap_character_sets;
+            CharacterSetConfig config = {};
+            config.num_sets = character_sets.character_sets_count;
+            for (uint8_t i = 0; i < character_sets.character_sets_count; i++) {
+                const PB_SplitflapCharacterSets_CharacterSet_flaps_t& flaps = character_sets.character_sets[i].flaps;
+                uint8_t num_flaps = min((int)flaps.size, (int)Spool::MAX_NUM_FLAPS);
+                memcpy(config.flaps[i], flaps.bytes, num_flaps);
+                config.num_flaps[i] = num_flaps;
+            }
+            memcpy(config.module_set, character_sets.module_character_sets.bytes,
+                    min((int)character_sets.module_character_sets.size, NUM_MODULES));
+            splitflap_task_.setCharacterSets(config);
+            break;
+        }
         case PB_ToSplitflap_request_state_tag:
             state_requested_ = true;
             break;
+        case PB_ToSplitflap_request_telemetry_tag:
+            telemetry_requested_ = true;
+            break;
         default: {
             char buf[200];
             snprintf(buf, sizeof(buf), "Unknown ToSplitflap type: %d", pb_rx_buffer_.which_payload);
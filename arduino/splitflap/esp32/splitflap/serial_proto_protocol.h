@@ -47,7 +47,9 @@ class SerialProtoProtocol : public SerialProtocol {
         uint32_t last_sent_state_millis_ = 0;
 
         bool state_requested_;
+        bool telemetry_requested_ = false;
 
+        void sendTelemetry();
         void sendPbTxBuffer();
         void handlePacket(const uint8_t* buffer, size_t size);
         void ack(uint32_t nonce);
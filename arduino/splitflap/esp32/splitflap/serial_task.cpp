@@ -58,12 +58,14 @@ void SerialTask::run() {
     splitflap_task_.setLogger(this);
 
     SplitflapState last_state = {};
+    uint32_t last_state_generation = 0;
     while(1) {
-        SplitflapState new_state = splitflap_task_.getState();
-
-        if (new_state != last_state) {
-            current_protocol->handleState(last_state, new_state);
-            last_state = new_state;
+        if (splitflap_task_.getStateGeneration() != last_state_generation) {
+            SplitflapState new_state = splitflap_task_.getState(&last_state_generation);
+            if (new_state != last_state) {
+                current_protocol->handleState(last_state, new_state);
+                last_state = new_state;
+            }
         }
 
         current_protocol->loop();
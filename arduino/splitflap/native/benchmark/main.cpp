@@ -0,0 +1,558 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "src/splitflap_module.h"
+#include "src/step_scheduler.h"
+
+#include "simulated_chain.h"
+
+enum class Scenario {
+    IDLE,
+    ACCELERATING,
+    CRUISING,
+    HOMING,
+    // One module in SPARSE_STRIDE cruising, the rest idle
+    SPARSE,
+};
+
+static const uint8_t SPARSE_STRIDE = 8;
+
+static const char* scenarioName(Scenario scenario) {
+    switch (scenario) {
+        case Scenario::IDLE:
+            return "idle";
+        case Scenario::ACCELERATING:
+            return "accelerating";
+        case Scenario::CRUISING:
+            return "cruising";
+        case Scenario::HOMING:
+            return "homing";
+        case Scenario::SPARSE:
+            return "sparse";
+    }
+    return "?";
+}
+
+enum class UpdatePath {
+    // Each SplitflapModule view updated individually, as runUpdate() used to do
+    PER_MODULE,
+    // SplitflapModuleBank::Update() in a single pass
+    BANK,
+    // StepScheduler::Update(), touching only modules with a step due
+    SCHEDULER,
+};
+
+static const uint8_t NUM_UPDATE_PATHS = 3;
+
+static const char* profileName(uint8_t profile) {
+    switch (profile) {
+        case Acceleration::PROFILE_DEFAULT:
+            return "default";
+        case Acceleration::PROFILE_QUIET:
+            return "quiet";
+        case Acceleration::PROFILE_S_CURVE:
+            return "s-curve";
+        case Acceleration::PROFILE_S_CURVE_FAST:
+            return "s-curve-fast";
+    }
+    return "?";
+}
+
+struct Result {
+    uint64_t update_nanos = 0;
+    // Update cost per module actually updated, for each frame that updated any. With the scheduler that is only the
+    // modules that had a step due.
+    std::vector<float> nanos_per_update;
+    uint64_t frames = 0;
+    uint64_t decode_nanos = 0;
+    std::vector<uint32_t> lateness_micros;
+};
+
+/**
+ * A bank of N modules wired up to a SimulatedChain, as initialize_modules() would do on real hardware.
+ */
+template <uint8_t N>
+class Bench {
+    public:
+        Bench() : chain_(N, N), sensor_previous_((chain_.sensorBytes() + 3) & ~3), scheduler_(bank_) {
+            modules_.reserve(N);
+            for (uint8_t i = 0; i < N; i++) {
+                bank_.Configure(i, chain_.motorByte(i), chain_.motorShift(i), chain_.sensorByte(i), chain_.sensorMask(i));
+                modules_.emplace_back(bank_, i);
+            }
+            decodeSensors();
+        }
+
+        // Fast-forwards (in virtual time) until every module has found home and stopped
+        bool homeAll() {
+            SimClock::useVirtualTime();
+            for (uint8_t i = 0; i < N; i++) {
+                bank_.Init(i);
+                bank_.GoHome(i);
+            }
+            bool ok = runVirtualUntil([this]() {
+                for (uint8_t i = 0; i < N; i++) {
+                    if (bank_.state[i] != NORMAL || bank_.current_accel_step[i] != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            }, 30000000);
+            for (uint8_t i = 0; i < N; i++) {
+                ok &= bank_.state[i] == NORMAL;
+            }
+            return ok;
+        }
+
+        void setUp(Scenario scenario) {
+            switch (scenario) {
+                case Scenario::IDLE:
+                    break;
+                case Scenario::ACCELERATING:
+                    // Pick a flap far enough away that the ramp can complete before decelerating
+                    for (SplitflapModuleView<N>& module : modules_) {
+                        module.GoToFlapIndex((module.GetCurrentFlapIndex() + NUM_FLAPS - 1) % NUM_FLAPS);
+                    }
+                    break;
+                case Scenario::CRUISING:
+                    for (SplitflapModuleView<N>& module : modules_) {
+                        module.GoToFlapIndex((module.GetCurrentFlapIndex() + NUM_FLAPS - 1) % NUM_FLAPS);
+                    }
+                    runVirtualUntil([this]() { return allAtAccelStep(Acceleration::MAX_ACCEL_STEP); }, 10000000);
+                    break;
+                case Scenario::HOMING:
+                    for (SplitflapModuleView<N>& module : modules_) {
+                        module.GoHome();
+                    }
+                    runVirtualUntil([this]() { return allAtAccelStep(Acceleration::MAX_ACCEL_STEP / 8); }, 10000000);
+                    break;
+                case Scenario::SPARSE:
+                    for (uint16_t i = 0; i < N; i += SPARSE_STRIDE) {
+                        modules_[i].GoToFlapIndex((modules_[i].GetCurrentFlapIndex() + NUM_FLAPS - 1) % NUM_FLAPS);
+                    }
+                    runVirtualUntil([this]() {
+                        for (uint16_t i = 0; i < N; i += SPARSE_STRIDE) {
+                            if (bank_.current_accel_step[i] < Acceleration::MAX_ACCEL_STEP) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }, 10000000);
+                    break;
+            }
+        }
+
+        // Runs the update loop in real time, measuring only the time spent updating modules.
+        Result measure(Scenario scenario, UpdatePath path, uint32_t duration_micros) {
+            Result result;
+            std::vector<unsigned long> expected_step_micros(N, 0);
+
+            SimClock::useRealTime();
+            unsigned long start = micros();
+            if (path == UpdatePath::SCHEDULER) {
+                // As SplitflapTask does after issuing commands
+                for (uint8_t i = 0; i < N; i++) {
+                    scheduler_.Wake(i, start);
+                }
+            }
+            while (true) {
+                unsigned long iteration_start = micros();
+                if (iteration_start - start >= duration_micros) {
+                    break;
+                }
+                if (scenario == Scenario::ACCELERATING && allAtAccelStep(Acceleration::MAX_ACCEL_STEP)) {
+                    break;
+                }
+
+                uint8_t updated = N;
+                auto t0 = std::chrono::steady_clock::now();
+                if (path == UpdatePath::SCHEDULER) {
+                    updated = scheduler_.Update(micros());
+                } else if (path == UpdatePath::BANK) {
+                    bank_.Update();
+                } else {
+                    for (SplitflapModuleView<N>& module : modules_) {
+                        module.Update();
+                    }
+                }
+                auto t1 = std::chrono::steady_clock::now();
+                uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+                result.update_nanos += nanos;
+                if (updated > 0) {
+                    result.nanos_per_update.push_back((float)nanos / updated);
+                }
+
+                chain_.io();
+                auto t2 = std::chrono::steady_clock::now();
+                decodeSensors();
+                result.decode_nanos += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t2).count();
+                result.frames++;
+
+                // Compare each step against the period the module requested for it
+                unsigned long now = micros();
+                for (uint8_t i = 0; i < N; i++) {
+                    if (!chain_.stepped(i)) {
+                        continue;
+                    }
+                    if (expected_step_micros[i] != 0) {
+                        long lateness = (long)(now - expected_step_micros[i]);
+                        result.lateness_micros.push_back(lateness > 0 ? lateness : 0);
+                    }
+                    expected_step_micros[i] = now + bank_.GetStepPeriod(i);
+                }
+            }
+            return result;
+        }
+
+        // Virtual time taken for every module to move the given number of flaps from rest using the given profile, or 0
+        // on timeout
+        uint32_t transitionMicros(uint8_t profile, uint8_t flaps) {
+            runVirtualUntil([this]() { return allParked(); }, 10000000);
+            unsigned long start = micros();
+            for (SplitflapModuleView<N>& module : modules_) {
+                module.SetMotionProfile(profile);
+                module.GoToFlapIndex((module.GetCurrentFlapIndex() + flaps) % NUM_FLAPS);
+            }
+            if (!runVirtualUntil([this]() { return allParked(); }, 30000000)) {
+                return 0;
+            }
+            return micros() - start;
+        }
+
+        // Virtual time module 0 takes to recover from its spool slipping by the given number of steps: from noticing
+        // the error (as it next passes home, moving most of a revolution at a time) to coming to rest on its target
+        // flap. Returns 0 if the error went unnoticed or the module didn't end up back in step with its spool. Sets
+        // search_micros to the part of that spent finding home.
+        uint32_t recoveryMicros(bool fast_rehome, int32_t slip_steps, uint32_t& search_micros) {
+            bank_.SetFastRehome(fast_rehome);
+            runVirtualUntil([this]() { return allParked(); }, 10000000);
+            uint32_t alignment = physicalOffset(0);
+
+            chain_.slip(0, slip_steps);
+            for (uint8_t move = 0; bank_.state[0] != LOOK_FOR_HOME; move++) {
+                if (move == 3) {
+                    return 0;
+                }
+                modules_[0].GoToFlapIndex((modules_[0].GetCurrentFlapIndex() + NUM_FLAPS - 1) % NUM_FLAPS);
+                runVirtualUntil([this]() { return bank_.state[0] == LOOK_FOR_HOME || allParked(); }, 10000000);
+            }
+            unsigned long start = micros();
+            if (!runVirtualUntil([this]() { return bank_.state[0] != LOOK_FOR_HOME; }, 30000000)) {
+                return 0;
+            }
+            search_micros = micros() - start;
+            if (!runVirtualUntil([this]() { return bank_.state[0] == NORMAL && allParked(); }, 30000000)) {
+                return 0;
+            }
+            uint32_t misalignment = (physicalOffset(0) + REVOLUTION_STEPS - alignment) % REVOLUTION_STEPS;
+            uint16_t margin = Spool::VARIANTS[Spool::SPOOL_DEFAULT].home_error_margin_steps;
+            if (misalignment > margin && misalignment < REVOLUTION_STEPS - margin) {
+                return 0;
+            }
+            return micros() - start;
+        }
+
+        // How far module 0's spool ends up from where it was on its flap just after homing, in steps, after passing home
+        // a few times at full speed with its home sensor reporting the given number of frames late. Returns INT32_MIN
+        // if it failed to home or had to re-home.
+        int32_t latencyDriftSteps(uint16_t latency_frames) {
+            chain_.setSensorLatency(latency_frames);
+            if (!homeAll()) {
+                return INT32_MIN;
+            }
+            uint32_t alignment = physicalOffset(0);
+            for (uint8_t move = 0; move < 4; move++) {
+                modules_[0].GoToFlapIndex((modules_[0].GetCurrentFlapIndex() + NUM_FLAPS - 1) % NUM_FLAPS);
+                if (!runVirtualUntil([this]() { return allParked(); }, 10000000) || bank_.state[0] != NORMAL) {
+                    return INT32_MIN;
+                }
+            }
+            int32_t drift = (physicalOffset(0) + REVOLUTION_STEPS - alignment) % REVOLUTION_STEPS;
+            return drift > (int32_t)REVOLUTION_STEPS / 2 ? drift - (int32_t)REVOLUTION_STEPS : drift;
+        }
+
+    private:
+        SimulatedChain chain_;
+        std::vector<uint8_t> sensor_previous_;
+        SplitflapModuleBank<N> bank_;
+        std::vector<SplitflapModuleView<N>> modules_;
+        StepScheduler<N> scheduler_;
+
+        // As spi_io_config.h does after each frame
+        void decodeSensors() {
+            bank_.DecodeSensors(chain_.sensorBuffer(), sensor_previous_.data(), chain_.sensorBytes(), 4);
+        }
+
+        bool allParked() {
+            for (uint8_t i = 0; i < N; i++) {
+                if (!bank_.IsParked(i)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static const uint32_t REVOLUTION_STEPS = GEAR_RATIO_INPUT_STEPS / _GEAR_RATIO_OUTPUT;
+
+        // Where module i's spool actually is within a revolution, relative to the start of the flap it's resting on
+        uint32_t physicalOffset(uint8_t i) {
+            uint32_t flap_start = Spool::Default::FlapStart(modules_[i].GetCurrentFlapIndex());
+            return (chain_.position(i) + REVOLUTION_STEPS - flap_start % REVOLUTION_STEPS) % REVOLUTION_STEPS;
+        }
+
+        bool allAtAccelStep(uint8_t accel_step) {
+            for (uint8_t i = 0; i < N; i++) {
+                if (bank_.current_accel_step[i] < accel_step) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename F>
+        bool runVirtualUntil(F done, uint32_t timeout_micros) {
+            SimClock::useVirtualTime();
+            unsigned long start = micros();
+            while (!done()) {
+                if (micros() - start > timeout_micros) {
+                    return false;
+                }
+                bank_.Update();
+                chain_.io();
+                decodeSensors();
+                SimClock::advance(50);
+            }
+            return true;
+        }
+};
+
+// Scenarios that failed to home, transitions that timed out and recoveries that failed; any of these fail the run
+static uint16_t failures = 0;
+
+template <typename T>
+static T percentile(std::vector<T>& values, uint8_t pct) {
+    if (values.empty()) {
+        return 0;
+    }
+    size_t index = (values.size() - 1) * pct / 100;
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+// Median update cost per module actually updated, leaving out frames where the scheduler found nothing due (the median
+// keeps the odd preemption from swamping paths that only update a few modules)
+static double nanosPerUpdate(Result& result) {
+    return percentile(result.nanos_per_update, 50);
+}
+
+// Update cost per I/O frame, i.e. what each pass of the task loop spends on module updates
+static double nanosPerFrame(const Result& result) {
+    return result.frames > 0 ? (double)result.update_nanos / result.frames : 0;
+}
+
+// Home sensor decoding cost per frame, spread over the modules like the update costs
+static double nanosPerDecode(const Result& result, uint8_t modules) {
+    return result.frames > 0 ? (double)result.decode_nanos / result.frames / modules : 0;
+}
+
+template <uint8_t N>
+static void runBenchmarks(uint32_t duration_millis) {
+    const Scenario scenarios[] = {Scenario::IDLE, Scenario::ACCELERATING, Scenario::CRUISING, Scenario::HOMING, Scenario::SPARSE};
+    for (Scenario scenario : scenarios) {
+        Result results[NUM_UPDATE_PATHS];
+        bool ok = true;
+        for (UpdatePath path : {UpdatePath::PER_MODULE, UpdatePath::BANK, UpdatePath::SCHEDULER}) {
+            Bench<N> bench;
+            if (!bench.homeAll()) {
+                ok = false;
+                break;
+            }
+            bench.setUp(scenario);
+            results[(int)path] = bench.measure(scenario, path, duration_millis * 1000);
+        }
+        if (!ok) {
+            printf("%-8u %-13s failed to home\n", N, scenarioName(scenario));
+            failures++;
+            continue;
+        }
+
+        // Jitter is reported for the scheduler, which is what SplitflapTask uses. Per-update costs aren't comparable
+        // between the paths (the bank also updates modules with no step due, which is cheap), so the per-frame costs
+        // are the like-for-like comparison.
+        Result& result = results[(int)UpdatePath::SCHEDULER];
+        size_t steps = result.lateness_micros.size();
+        uint32_t max_lateness = steps > 0 ? *std::max_element(result.lateness_micros.begin(), result.lateness_micros.end()) : 0;
+        printf("%-8u %-13s %12.2f %12.2f %12.2f %12.1f %12.1f %12.2f %8uus %8uus %8uus %8zu\n",
+                N,
+                scenarioName(scenario),
+                nanosPerUpdate(results[(int)UpdatePath::PER_MODULE]),
+                nanosPerUpdate(results[(int)UpdatePath::BANK]),
+                nanosPerUpdate(result),
+                nanosPerFrame(results[(int)UpdatePath::BANK]),
+                nanosPerFrame(result),
+                nanosPerDecode(result, N),
+                percentile(result.lateness_micros, 50),
+                percentile(result.lateness_micros, 99),
+                max_lateness,
+                steps);
+    }
+}
+
+// Reports how long each motion profile takes to display a new flap, which is what the profile choice trades off
+static void runTransitionBenchmarks() {
+    const uint8_t distances[] = {1, 5, 20, NUM_FLAPS - 1};
+
+    printf("\nTransition time by motion profile (ms, from rest to rest)\n\n");
+    printf("%-13s %12s", "profile", "flaps/sec");
+    for (uint8_t flaps : distances) {
+        char label[16];
+        snprintf(label, sizeof(label), "%u flap%s", flaps, flaps == 1 ? "" : "s");
+        printf(" %12s", label);
+    }
+    printf("\n");
+
+    for (uint8_t profile = 0; profile < Acceleration::NUM_PROFILES; profile++) {
+        const Acceleration::ProfileInfo& info = Acceleration::PROFILES[profile];
+        uint16_t full_speed_period = pgm_read_word_near(info.periods + info.max_accel_step);
+        printf("%-13s %12.1f", profileName(profile), 1e6 * GEAR_RATIO_OUTPUT_FLAPS / ((double)full_speed_period * GEAR_RATIO_INPUT_STEPS));
+
+        Bench<1> bench;
+        if (!bench.homeAll()) {
+            printf(" failed to home\n");
+            failures++;
+            continue;
+        }
+        for (uint8_t flaps : distances) {
+            uint32_t micros = bench.transitionMicros(profile, flaps);
+            if (micros == 0) {
+                printf(" %12s", "timeout");
+                failures++;
+            } else {
+                printf(" %12.1f", micros / 1000.0);
+            }
+        }
+        printf("\n");
+    }
+}
+
+// Reports how long a module takes to re-home after its position slips, with a full slow search for home versus
+// the targeted search that approaches the predicted home position (or searches ahead for a missed one) at full speed
+static void runRecoveryBenchmarks() {
+    const uint8_t TRIALS = 50;
+    const uint16_t margin = Spool::VARIANTS[Spool::SPOOL_DEFAULT].home_error_margin_steps;
+    const uint16_t flap_steps = GEAR_RATIO_INPUT_STEPS / GEAR_RATIO_OUTPUT_FLAPS;
+
+    printf("\nRecovery time after a slipped spool (ms, mean of %u, from detecting the error to finding home, and to resting on\n"
+            "the target)\n\n", TRIALS);
+    printf("%-16s %12s %12s %12s %12s %8s\n", "error", "find(slow)", "find(target)", "slow search", "targeted", "failed");
+
+    for (bool ahead : {true, false}) {
+        // Spool pushed on shows up as an unexpected home; one that skipped steps misses home
+        double mean_millis[2] = {0, 0};
+        double mean_search_millis[2] = {0, 0};
+        uint16_t failed = 0;
+        for (bool fast_rehome : {false, true}) {
+            Bench<1> bench;
+            if (!bench.homeAll()) {
+                failed += TRIALS;
+                continue;
+            }
+            std::mt19937 rng(1);
+            std::uniform_int_distribution<int32_t> slip(2 * margin, 3 * flap_steps);
+            uint32_t total_micros = 0;
+            uint32_t total_search_micros = 0;
+            uint8_t recovered = 0;
+            for (uint8_t t = 0; t < TRIALS; t++) {
+                int32_t slip_steps = slip(rng);
+                uint32_t search_micros = 0;
+                uint32_t micros = bench.recoveryMicros(fast_rehome, ahead ? slip_steps : -slip_steps, search_micros);
+                if (micros == 0) {
+                    failed++;
+                    // Start the next trial from a known position
+                    if (!bench.homeAll()) {
+                        break;
+                    }
+                    continue;
+                }
+                total_micros += micros;
+                total_search_micros += search_micros;
+                recovered++;
+            }
+            mean_millis[fast_rehome] = recovered > 0 ? total_micros / 1000.0 / recovered : 0;
+            mean_search_millis[fast_rehome] = recovered > 0 ? total_search_micros / 1000.0 / recovered : 0;
+        }
+        printf("%-16s %12.1f %12.1f %12.1f %12.1f %8u\n", ahead ? "unexpected home" : "missed home",
+                mean_search_millis[0], mean_search_millis[1], mean_millis[0], mean_millis[1], failed);
+        failures += failed;
+    }
+}
+
+// Checks that a home sensor with a constant latency doesn't move the displayed flap: homing finds home late by less
+// than home is seen at full speed, which should be learned as the offset rather than corrected as lost steps
+static void runSensorLatencyChecks() {
+    // Frames are 50us apart in virtual time
+    const uint16_t latencies[] = {0, 40, 80, 120, 160};
+
+    printf("\nDisplayed flap drift with a slow home sensor (steps, after passing home 4 times)\n\n");
+    printf("%-16s %12s\n", "latency (us)", "drift");
+    for (uint16_t frames : latencies) {
+        Bench<1> bench;
+        int32_t drift = bench.latencyDriftSteps(frames);
+        if (drift == INT32_MIN) {
+            printf("%-16u %12s\n", frames * 50, "failed");
+            failures++;
+            continue;
+        }
+        printf("%-16u %12d\n", frames * 50, drift);
+        if (drift != 0) {
+            failures++;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32_t duration_millis = argc > 1 ? atoi(argv[1]) : 200;
+
+    printf("Module update benchmark (%u ms per scenario)\n\n", duration_millis);
+    printf("%-8s %-13s %12s %12s %12s %12s %12s %12s %10s %10s %10s %8s\n",
+            "modules", "scenario", "ns(module)", "ns(bank)", "ns(sched)", "frame(bank)", "frame(sched)",
+            "ns(sensors)", "jitter50", "jitter99", "jittermax", "steps");
+
+    runBenchmarks<1>(duration_millis);
+    runBenchmarks<6>(duration_millis);
+    runBenchmarks<12>(duration_millis);
+    runBenchmarks<24>(duration_millis);
+    runBenchmarks<48>(duration_millis);
+    runBenchmarks<96>(duration_millis);
+    runBenchmarks<120>(duration_millis);
+    runBenchmarks<180>(duration_millis);
+    runBenchmarks<255>(duration_millis);
+
+    runTransitionBenchmarks();
+    runRecoveryBenchmarks();
+    runSensorLatencyChecks();
+
+    printf("\n%u failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
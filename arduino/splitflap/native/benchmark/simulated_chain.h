@@ -0,0 +1,105 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <stdint.h>
+
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "simulated_motor.h"
+
+/**
+ * Simulated chain of shift-register driver boards with one motor + home sensor per module.
+ *
+ * Buffers follow the (non-Chainlink) layout from spi_io_config.h: two modules per motor byte, four modules per
+ * sensor byte. After the driver has written new motor phases, call io() to "clock" the chain: each module's phase
+ * nibble is decoded into motion of a physical spool, and the home sensor bit is set whenever the spool's home
+ * magnet is under the sensor (optionally a few frames late, like a slow sensor).
+ */
+class SimulatedChain {
+    public:
+        SimulatedChain(uint16_t num_modules, uint32_t seed = 1) :
+                num_modules_(num_modules),
+                sensor_bytes_(num_modules / 4 + (num_modules % 4 != 0)),
+                motor_buffer_(num_modules / 2 + (num_modules % 2 != 0)),
+                sensor_buffer_((sensor_bytes_ + 3) & ~3),
+                motors_(num_modules),
+                sensor_history_(num_modules),
+                sensor_latency_frames_(0) {
+            std::mt19937 rng(seed);
+            std::uniform_int_distribution<uint32_t> position(0, GEAR_RATIO_INPUT_STEPS - 1);
+            for (uint16_t i = 0; i < num_modules_; i++) {
+                motors_[i].setPosition(position(rng));
+            }
+            io();
+        }
+
+        uint8_t& motorByte(uint16_t i) { return motor_buffer_[motor_buffer_.size() - 1 - i/2]; }
+        uint8_t motorShift(uint16_t i) const { return i % 2 == 0 ? 0 : 4; }
+        uint8_t& sensorByte(uint16_t i) { return sensor_buffer_[i/4]; }
+        uint8_t sensorMask(uint16_t i) const { return 1 << (i % 4); }
+
+        // Sensor bytes (4 modules each), padded to whole words as SplitflapModuleBank::DecodeSensors() expects
+        const uint8_t* sensorBuffer() const { return sensor_buffer_.data(); }
+        uint8_t sensorBytes() const { return sensor_bytes_; }
+
+        // Physical spool position, in motor steps modulo GEAR_RATIO_INPUT_STEPS
+        uint32_t position(uint16_t i) const { return motors_[i].position(); }
+
+        // Whether the motor moved during the most recent io()
+        bool stepped(uint16_t i) const { return motors_[i].stepped(); }
+
+        // Number of phase changes that couldn't be interpreted as a single step (the real motor would stall)
+        uint32_t skippedSteps(uint16_t i) const { return motors_[i].skippedSteps(); }
+
+        // Turns a spool behind the driver's back, as if the motor had skipped (negative) or been pushed on (positive)
+        void slip(uint16_t i, int32_t steps) {
+            motors_[i].slip(steps);
+        }
+
+        // Reports each home sensor the given number of io() frames after the spool actually gets there
+        void setSensorLatency(uint16_t frames) {
+            sensor_latency_frames_ = frames;
+        }
+
+        void io() {
+            for (uint16_t i = 0; i < num_modules_; i++) {
+                motors_[i].drive(motorByte(i) >> motorShift(i));
+                std::deque<bool>& history = sensor_history_[i];
+                history.push_back(motors_[i].home());
+                while (history.size() > sensor_latency_frames_ + 1u) {
+                    history.pop_front();
+                }
+                if (history.front()) {
+                    sensorByte(i) |= sensorMask(i);
+                } else {
+                    sensorByte(i) &= ~sensorMask(i);
+                }
+            }
+        }
+
+    private:
+        const uint16_t num_modules_;
+        const uint8_t sensor_bytes_;
+        std::vector<uint8_t> motor_buffer_;
+        std::vector<uint8_t> sensor_buffer_;
+        std::vector<SimulatedMotor> motors_;
+        // Whether home was under each sensor, for the last sensor_latency_frames_ + 1 frames (oldest first)
+        std::vector<std::deque<bool>> sensor_history_;
+        uint16_t sensor_latency_frames_;
+};
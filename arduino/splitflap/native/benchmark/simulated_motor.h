@@ -0,0 +1,88 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <stdint.h>
+
+#include "src/splitflap_module.h"
+
+// Width of the simulated home magnet, in motor steps
+#define SIM_HOME_SENSOR_WIDTH_STEPS (16 * STEPS_PER_FULL_STEP)
+
+/**
+ * Simulated stepper motor turning a physical spool, with a home sensor. drive() decodes each new coil pattern
+ * (a step_pattern entry) into a step forwards or backwards.
+ */
+class SimulatedMotor {
+    public:
+        // Applies the coil pattern now being driven (the low nibble of out)
+        void drive(uint8_t out) {
+            out &= 0x0F;
+            stepped_ = false;
+
+            int8_t phase = -1;
+            for (uint8_t p = 0; p < PATTERN_LENGTH; p++) {
+                if (step_pattern[p] == out) {
+                    phase = p;
+                }
+            }
+
+            // A de-energized motor holds its position (detent torque is plenty for a spool of flaps)
+            if (phase != -1 && phase != phase_) {
+                if (phase_ == -1 || phase == (phase_ + 1) % PATTERN_LENGTH) {
+                    position_ = position_ + 1 == GEAR_RATIO_INPUT_STEPS ? 0 : position_ + 1;
+                    stepped_ = true;
+                } else if ((phase + 1) % PATTERN_LENGTH == phase_) {
+                    position_ = position_ == 0 ? GEAR_RATIO_INPUT_STEPS - 1 : position_ - 1;
+                    stepped_ = true;
+                } else {
+                    skipped_++;
+                }
+                phase_ = phase;
+            }
+        }
+
+        // Whether the spool's home magnet is under the sensor
+        bool home() const {
+            // GEAR_RATIO_INPUT_STEPS is _GEAR_RATIO_OUTPUT spool revolutions, so scale the step position up to find
+            // the angle within a single revolution.
+            return (position_ * _GEAR_RATIO_OUTPUT) % GEAR_RATIO_INPUT_STEPS
+                    < SIM_HOME_SENSOR_WIDTH_STEPS * _GEAR_RATIO_OUTPUT;
+        }
+
+        // Physical spool position, in motor steps modulo GEAR_RATIO_INPUT_STEPS
+        uint32_t position() const { return position_; }
+        void setPosition(uint32_t position) { position_ = position % GEAR_RATIO_INPUT_STEPS; }
+
+        // Whether the motor moved on the most recent drive()
+        bool stepped() const { return stepped_; }
+
+        // Number of phase changes that couldn't be interpreted as a single step (the real motor would stall)
+        uint32_t skippedSteps() const { return skipped_; }
+
+        // Turns the spool behind the driver's back, as if the motor had skipped (negative) or been pushed on (positive)
+        void slip(int32_t steps) {
+            position_ = (position_ + GEAR_RATIO_INPUT_STEPS + steps % (int32_t)GEAR_RATIO_INPUT_STEPS) % GEAR_RATIO_INPUT_STEPS;
+        }
+
+    private:
+        static const uint8_t PATTERN_LENGTH = sizeof(step_pattern) / sizeof(step_pattern[0]);
+
+        uint32_t position_ = 0;
+        int8_t phase_ = -1;
+        bool stepped_ = false;
+        uint32_t skipped_ = 0;
+};
@@ -0,0 +1,217 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <stdint.h>
+
+#include <random>
+#include <vector>
+
+#include <sim_hardware.h>
+
+#include "../benchmark/simulated_motor.h"
+
+/**
+ * Emulated chain of Chainlink Driver boards, attached to the native shim's SPI bus and latch pins in place of real
+ * hardware, so the unmodified I/O code in spi_io_config.h (initialize_modules(), motor_sensor_io(), the chainlink_*
+ * LED and loopback functions) can be run on the host.
+ *
+ * Each board has four 74HC595 output registers (two motors per register, or one motor and half the LEDs and a
+ * loopback output) and one 74HC165 input register (six home sensors and the two loopback inputs). Output bytes shift
+ * away from the controller as bytes are transferred, and only reach the motors, LEDs and loopbacks on the rising edge
+ * of the output latch. Inputs are loaded while the input latch is low, and shift towards the controller (nearest
+ * board first), followed by whatever the far end of the chain is tied to. Boards are numbered from the controller.
+ *
+ * Faults can be injected into the loopback wiring and input registers, to check the firmware notices them.
+ */
+class ChainlinkEmulator : public SimHardware {
+    public:
+        static const uint8_t MODULES_PER_BOARD = 6;
+        static const uint8_t OUTPUT_BYTES_PER_BOARD = 4;
+        static const uint8_t LOOPBACKS_PER_BOARD = 2;
+
+        ChainlinkEmulator(uint8_t boards, uint8_t out_latch_pin, uint8_t in_latch_pin, uint32_t seed = 1) :
+                boards_(boards),
+                out_latch_pin_(out_latch_pin),
+                in_latch_pin_(in_latch_pin),
+                out_shift_(boards * OUTPUT_BYTES_PER_BOARD),
+                out_latched_(boards * OUTPUT_BYTES_PER_BOARD),
+                in_shift_(boards),
+                stuck_input_mask_(boards),
+                stuck_input_value_(boards),
+                broken_loopback_(boards * LOOPBACKS_PER_BOARD),
+                short_loopback_(boards * LOOPBACKS_PER_BOARD, NO_SHORT),
+                motors_(boards * MODULES_PER_BOARD) {
+            std::mt19937 rng(seed);
+            std::uniform_int_distribution<uint32_t> position(0, GEAR_RATIO_INPUT_STEPS - 1);
+            for (SimulatedMotor& motor : motors_) {
+                motor.setPosition(position(rng));
+            }
+        }
+
+        void digitalWrite(uint8_t pin, uint8_t value) override {
+            if (pin == out_latch_pin_) {
+                if (value && !out_latch_) {
+                    latchOutputs();
+                }
+                out_latch_ = value;
+            } else if (pin == in_latch_pin_) {
+                in_loading_ = !value;
+                if (in_loading_) {
+                    loadInputs();
+                }
+            }
+        }
+
+        uint8_t transfer(uint8_t out) override {
+            transfers_++;
+
+            for (size_t i = out_shift_.size(); i-- > 1;) {
+                out_shift_[i] = out_shift_[i - 1];
+            }
+            if (!out_shift_.empty()) {
+                out_shift_[0] = out;
+            }
+
+            // While loading, the 74HC165s ignore the clock and just present the first board's inputs
+            uint8_t in = in_shift_.empty() ? serial_in_ : in_shift_[0];
+            if (!in_loading_) {
+                for (size_t i = 0; i + 1 < in_shift_.size(); i++) {
+                    in_shift_[i] = in_shift_[i + 1];
+                }
+                if (!in_shift_.empty()) {
+                    in_shift_.back() = serial_in_;
+                }
+            }
+            return in;
+        }
+
+        uint8_t boards() const { return boards_; }
+        uint16_t modules() const { return motors_.size(); }
+
+        // Bytes transferred and output latches (i.e. frames) so far
+        uint64_t transfers() const { return transfers_; }
+        uint64_t outputLatches() const { return output_latches_; }
+
+        SimulatedMotor& motor(uint16_t module) { return motors_[module]; }
+
+        bool led(uint16_t module) const {
+            uint8_t board = module / MODULES_PER_BOARD;
+            uint8_t p = module % MODULES_PER_BOARD;
+            return p < 3 ? (latchedByte(board, 1) >> (4 + p)) & 1 : (latchedByte(board, 2) >> (p - 3)) & 1;
+        }
+
+        bool loopbackOutput(uint16_t loopback) const {
+            uint8_t board = loopback / LOOPBACKS_PER_BOARD;
+            return loopback % 2 == 0 ? (latchedByte(board, 1) >> 7) & 1 : (latchedByte(board, 2) >> 3) & 1;
+        }
+
+        // What the serial input of the last 74HC165 is tied to, i.e. what's read past the end of the chain
+        void setSerialIn(uint8_t value) { serial_in_ = value; }
+
+        // Input register bit (0-5 home sensors, 6-7 loopbacks) reads value regardless of what's connected to it
+        void setStuckInput(uint8_t board, uint8_t bit, bool value) {
+            stuck_input_mask_[board] |= 1 << bit;
+            if (value) {
+                stuck_input_value_[board] |= 1 << bit;
+            } else {
+                stuck_input_value_[board] &= ~(1 << bit);
+            }
+        }
+
+        // Open circuit between a loopback's output and input, which then reads 0
+        void breakLoopback(uint16_t loopback) { broken_loopback_[loopback] = true; }
+
+        // Short between two loopbacks, so both inputs read high if either output is
+        void shortLoopbacks(uint16_t a, uint16_t b) {
+            short_loopback_[a] = b;
+            short_loopback_[b] = a;
+        }
+
+        void clearFaults() {
+            std::fill(stuck_input_mask_.begin(), stuck_input_mask_.end(), 0);
+            std::fill(broken_loopback_.begin(), broken_loopback_.end(), false);
+            std::fill(short_loopback_.begin(), short_loopback_.end(), NO_SHORT);
+        }
+
+    private:
+        static const uint16_t NO_SHORT = UINT16_MAX;
+
+        const uint8_t boards_;
+        const uint8_t out_latch_pin_;
+        const uint8_t in_latch_pin_;
+
+        bool out_latch_ = false;
+        bool in_loading_ = false;
+        uint8_t serial_in_ = 0;
+        uint64_t transfers_ = 0;
+        uint64_t output_latches_ = 0;
+
+        // Output registers, nearest the controller first
+        std::vector<uint8_t> out_shift_;
+        std::vector<uint8_t> out_latched_;
+        // Input registers, nearest the controller first
+        std::vector<uint8_t> in_shift_;
+
+        std::vector<uint8_t> stuck_input_mask_;
+        std::vector<uint8_t> stuck_input_value_;
+        std::vector<bool> broken_loopback_;
+        std::vector<uint16_t> short_loopback_;
+
+        std::vector<SimulatedMotor> motors_;
+
+        uint8_t latchedByte(uint8_t board, uint8_t i) const {
+            return out_latched_[board * OUTPUT_BYTES_PER_BOARD + i];
+        }
+
+        void latchOutputs() {
+            out_latched_ = out_shift_;
+            output_latches_++;
+
+            for (uint8_t board = 0; board < boards_; board++) {
+                SimulatedMotor* m = &motors_[board * MODULES_PER_BOARD];
+                m[0].drive(latchedByte(board, 0));
+                m[1].drive(latchedByte(board, 0) >> 4);
+                m[2].drive(latchedByte(board, 1));
+                m[3].drive(latchedByte(board, 2) >> 4);
+                m[4].drive(latchedByte(board, 3));
+                m[5].drive(latchedByte(board, 3) >> 4);
+            }
+        }
+
+        bool loopbackInput(uint16_t loopback) const {
+            if (broken_loopback_[loopback]) {
+                return false;
+            }
+            bool value = loopbackOutput(loopback);
+            if (short_loopback_[loopback] != NO_SHORT) {
+                value |= loopbackOutput(short_loopback_[loopback]);
+            }
+            return value;
+        }
+
+        void loadInputs() {
+            for (uint8_t board = 0; board < boards_; board++) {
+                uint8_t value = 0;
+                for (uint8_t p = 0; p < MODULES_PER_BOARD; p++) {
+                    value |= motors_[board * MODULES_PER_BOARD + p].home() << p;
+                }
+                value |= loopbackInput(board * LOOPBACKS_PER_BOARD) << 6;
+                value |= loopbackInput(board * LOOPBACKS_PER_BOARD + 1) << 7;
+                in_shift_[board] = (value & ~stuck_input_mask_[board]) | (stuck_input_value_[board] & stuck_input_mask_[board]);
+            }
+        }
+};
@@ -0,0 +1,350 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "config.h"
+#include "src/splitflap_module.h"
+#include "src/spi_io_config.h"
+#include "src/step_scheduler.h"
+
+#include "chainlink_emulator.h"
+
+#ifndef CHAINLINK
+#error The Chainlink emulator needs a CHAINLINK build (see the native_chainlink environment in platformio.ini)
+#endif
+#if NUM_MODULES % 6 != 0
+// NUM_LOOPBACKS only covers whole boards, so a partly used last board can't be discovered
+#error The Chainlink emulator needs NUM_MODULES to be a multiple of 6
+#endif
+
+static const uint8_t NUM_BOARDS = (NUM_MODULES + CHAINLINK_MODULES_PER_BOARD - 1) / CHAINLINK_MODULES_PER_BOARD;
+static const uint32_t REVOLUTION_STEPS = GEAR_RATIO_INPUT_STEPS / _GEAR_RATIO_OUTPUT;
+
+static uint16_t failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("%-56s %s\n", what, ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+
+// Runs the firmware's update/IO loop in virtual time until done() or the timeout
+static bool runVirtualUntil(std::function<bool()> done, uint32_t timeout_micros) {
+    SimClock::useVirtualTime();
+    unsigned long start = micros();
+    while (!done()) {
+        if (micros() - start > timeout_micros) {
+            return false;
+        }
+        module_bank.Update();
+        motor_sensor_io();
+        SimClock::advance(50);
+    }
+    return true;
+}
+
+static bool allParked() {
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        if (!module_bank.IsParked(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Where module i's emulated spool actually is within a revolution, relative to the start of the flap it's resting on
+static uint32_t physicalOffset(ChainlinkEmulator& chain, uint8_t i) {
+    uint32_t flap_start = Spool::Default::FlapStart(modules[i]->GetCurrentFlapIndex());
+    return (chain.motor(i).position() + REVOLUTION_STEPS - flap_start % REVOLUTION_STEPS) % REVOLUTION_STEPS;
+}
+
+/**
+ * Checks that every module's motor, home sensor and LED bits in the I/O buffers end up at that module's emulated
+ * hardware: each LED lights on its own, every module homes (so its sensor bit follows its own spool) to the same
+ * physical position, and moving a module turns only its own spool.
+ */
+static void runMappingChecks() {
+    printf("Byte mapping (%u modules on %u boards)\n\n", NUM_MODULES, NUM_BOARDS);
+
+    ChainlinkEmulator chain(NUM_BOARDS, OUT_LATCH_PIN, IN_LATCH_PIN);
+    SimHardware::attach(&chain);
+    SimClock::useVirtualTime();
+    initialize_modules();
+
+    bool leds_ok = true;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        chainlink_set_led(i, true);
+        motor_sensor_io();
+        for (uint8_t j = 0; j < NUM_MODULES; j++) {
+            leds_ok &= chain.led(j) == (i == j);
+        }
+        chainlink_set_led(i, false);
+    }
+    check(leds_ok, "each LED lights only its own module's LED");
+
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        modules[i]->Init();
+        modules[i]->GoHome();
+    }
+    bool homed = runVirtualUntil([]() {
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            if (module_bank.state[i] != NORMAL) {
+                return false;
+            }
+        }
+        return allParked();
+    }, 30000000);
+    check(homed, "every module finds home");
+
+    uint16_t margin = Spool::VARIANTS[Spool::SPOOL_DEFAULT].home_error_margin_steps;
+    bool aligned = homed;
+    for (uint8_t i = 1; homed && i < NUM_MODULES; i++) {
+        uint32_t misalignment = (physicalOffset(chain, i) + REVOLUTION_STEPS - physicalOffset(chain, 0)) % REVOLUTION_STEPS;
+        aligned &= misalignment <= margin || misalignment >= REVOLUTION_STEPS - margin;
+    }
+    check(aligned, "every spool rests on the same physical flap position");
+
+    bool isolated = homed;
+    for (uint8_t i = 0; homed && i < NUM_MODULES; i++) {
+        std::vector<uint32_t> before;
+        for (uint8_t j = 0; j < NUM_MODULES; j++) {
+            before.push_back(chain.motor(j).position());
+        }
+        modules[i]->GoToFlapIndex((modules[i]->GetCurrentFlapIndex() + 1) % NUM_FLAPS);
+        isolated &= runVirtualUntil([]() { return allParked(); }, 10000000);
+        for (uint8_t j = 0; j < NUM_MODULES; j++) {
+            isolated &= (chain.motor(j).position() != before[j]) == (i == j);
+        }
+    }
+    check(isolated, "moving a module turns only its own spool");
+
+    bool no_skips = true;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        no_skips &= chain.motor(i).skippedSteps() == 0;
+    }
+    check(no_skips, "no motor is driven through an invalid phase change");
+
+    SimHardware::attach(nullptr);
+}
+
+/**
+ * Checks that the startup loopback test passes on a healthy chain, and that board discovery finds however many boards
+ * are actually connected, whether the end of the chain reads low or (pulled up) high.
+ */
+static void runDiscoveryChecks() {
+    printf("\nBoard discovery\n\n");
+
+    for (uint8_t serial_in : {0x00, 0xFF}) {
+        for (uint8_t connected = NUM_BOARDS; connected >= 1; connected = connected > 2 ? connected / 2 : connected - 1) {
+            ChainlinkEmulator chain(connected, OUT_LATCH_PIN, IN_LATCH_PIN);
+            chain.setSerialIn(serial_in);
+            SimHardware::attach(&chain);
+            initialize_modules();
+            chainlink_num_loopbacks = NUM_LOOPBACKS;
+
+            bool loopback_result[NUM_LOOPBACKS][NUM_LOOPBACKS];
+            bool loopback_off_result[NUM_LOOPBACKS];
+            bool passed = chainlink_test_all_loopbacks(loopback_result, loopback_off_result);
+            uint8_t boards;
+            bool consistent = chainlink_count_boards(loopback_result, loopback_off_result, &boards);
+
+            char what[64];
+            snprintf(what, sizeof(what), "%u of %u boards, chain end reads 0x%02x: found %u",
+                    connected, NUM_BOARDS, serial_in, consistent ? boards : 0);
+            check(consistent && boards == connected && passed == (connected == NUM_BOARDS), what);
+        }
+    }
+
+    SimHardware::attach(nullptr);
+}
+
+struct Fault {
+    const char* name;
+    std::function<void(ChainlinkEmulator&)> inject;
+    uint8_t missing_boards;
+};
+
+// Output latches (frames) until a full sweep of set/validate checks first fails, or 0 if it never does
+static uint32_t framesToDetect(ChainlinkEmulator& chain, uint8_t checks, std::function<void(uint8_t)> set, std::function<bool(uint8_t)> validate) {
+    uint64_t start = chain.outputLatches();
+    for (uint8_t c = 0; c < checks; c++) {
+        set(c);
+        motor_sensor_io();
+        motor_sensor_io();
+        if (!validate(c)) {
+            return chain.outputLatches() - start;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Injects wiring faults into the loopbacks and reports whether the startup test catches each, and how many frames
+ * into a sweep the runtime checks (one loopback at a time, or binary-coded patterns) first notice it.
+ */
+static void runFaultChecks() {
+    const uint8_t last = NUM_LOOPBACKS - 1;
+    const std::vector<Fault> faults = {
+        {"last loopback open", [=](ChainlinkEmulator& c) { c.breakLoopback(last); }, 0},
+        {"first loopback input stuck high", [](ChainlinkEmulator& c) { c.setStuckInput(0, 6, true); }, 0},
+        {"last loopback input stuck low", [=](ChainlinkEmulator& c) { c.setStuckInput(last / 2, last % 2 == 0 ? 6 : 7, false); }, 0},
+        {"loopbacks on one board shorted", [](ChainlinkEmulator& c) { c.shortLoopbacks(0, 1); }, 0},
+        {"loopbacks across the chain shorted", [=](ChainlinkEmulator& c) { c.shortLoopbacks(last / 2, last); }, 0},
+        {"last board missing", [](ChainlinkEmulator& c) {}, 1},
+    };
+
+    printf("\nLoopback faults (%u loopbacks; frames into a sweep until detected)\n\n", NUM_LOOPBACKS);
+    printf("%-36s %10s %12s %12s\n", "fault", "startup", "one-by-one", "binary");
+
+    chainlink_num_loopbacks = NUM_LOOPBACKS;
+    for (const Fault& fault : faults) {
+        ChainlinkEmulator chain(NUM_BOARDS - fault.missing_boards, OUT_LATCH_PIN, IN_LATCH_PIN);
+        fault.inject(chain);
+        SimHardware::attach(&chain);
+        initialize_modules();
+
+        bool loopback_result[NUM_LOOPBACKS][NUM_LOOPBACKS];
+        bool loopback_off_result[NUM_LOOPBACKS];
+        bool startup = !chainlink_test_all_loopbacks(loopback_result, loopback_off_result);
+
+        uint32_t one_by_one = framesToDetect(chain, NUM_LOOPBACKS,
+                [](uint8_t l) { chainlink_set_loopback(l); },
+                [](uint8_t l) { return chainlink_validate_loopback(l, nullptr); });
+        uint32_t binary = framesToDetect(chain, chainlink_loopback_pattern_count(),
+                [](uint8_t p) { chainlink_set_loopback_pattern(p); },
+                [](uint8_t p) { return chainlink_validate_loopback_pattern(p); });
+
+        printf("%-36s %10s %12u %12u\n", fault.name, startup ? "detected" : "MISSED", one_by_one, binary);
+        failures += !startup + (one_by_one == 0) + (binary == 0);
+    }
+    printf("%-36s %10s %12u %12u\n", "(full sweep)", "", NUM_LOOPBACKS * 2, chainlink_loopback_pattern_count() * 2);
+
+    SimHardware::attach(nullptr);
+}
+
+/**
+ * Frame rate through the emulated chain on this machine, against the rate the bus itself allows at SPI_CLOCK with the
+ * modules in one chain. The 2-chain figure is only a theoretical bound for NUM_IO_CHAINS=2 on ESP32 (SPI_CLOCK divided
+ * by the bits in the longer chain): two chains can't be emulated here, and latching and task overhead aren't counted.
+ */
+static void runThroughput(uint32_t frames) {
+    ChainlinkEmulator chain(NUM_BOARDS, OUT_LATCH_PIN, IN_LATCH_PIN);
+    SimHardware::attach(&chain);
+    initialize_modules();
+
+    uint64_t start_bytes = SPI.bytesTransferred();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; i++) {
+        motor_sensor_io();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double bytes_per_frame = (double)(SPI.bytesTransferred() - start_bytes) / frames;
+
+    // Split as SECOND_CHAIN_FIRST_MODULE does by default
+    const uint8_t second_chain_first_module = (NUM_MODULES / 2 + CHAINLINK_MODULES_PER_BOARD - 1) / CHAINLINK_MODULES_PER_BOARD * CHAINLINK_MODULES_PER_BOARD;
+    uint8_t split_bytes = std::max(MOTOR_BYTES(second_chain_first_module), MOTOR_BYTES(NUM_MODULES - second_chain_first_module));
+
+    printf("\nI/O throughput (%u frames)\n\n", frames);
+    printf("%-12s %14s %16s %16s\n", "bytes/frame", "host frames/s", "bus frames/s", "2-chain bound");
+    printf("%-12.1f %14.0f %16.0f %16.0f\n", bytes_per_frame, frames / seconds,
+            SPI.clock() / (bytes_per_frame * 8), SPI.clock() / (split_bytes * 8.0));
+
+    SimHardware::attach(nullptr);
+}
+
+/**
+ * Estimated frame rate of the ESP32 update loop (SplitflapTask::runUpdate) with every module cruising, with synchronous
+ * I/O and with ASYNC_MOTOR_SENSOR_IO. The CPU's share of each frame (scheduler update, packing motor outputs, decoding
+ * sensors) is timed on this machine while the emulated modules move in virtual time, one bus frame per frame; the bus
+ * time comes from SPI_CLOCK. Synchronous I/O does one after the other, whereas pipelined I/O overlaps them and so runs
+ * at whichever is slower.
+ */
+static void runPipelineEstimate(uint32_t frames) {
+    ChainlinkEmulator chain(NUM_BOARDS, OUT_LATCH_PIN, IN_LATCH_PIN);
+    SimHardware::attach(&chain);
+    SimClock::useVirtualTime();
+    initialize_modules();
+    StepScheduler<NUM_MODULES> scheduler(module_bank);
+
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        modules[i]->Init();
+        modules[i]->GoHome();
+    }
+    bool homed = runVirtualUntil([]() { return allParked(); }, 30000000);
+
+    uint64_t start_bytes = SPI.bytesTransferred();
+    motor_sensor_io();
+    double bus_micros = (SPI.bytesTransferred() - start_bytes) * 8 * 1e6 / SPI.clock();
+
+    uint64_t cpu_nanos = 0;
+    uint8_t previous[SENSOR_BUFFER_WORD_LENGTH];
+    for (uint32_t f = 0; homed && f < frames; f++) {
+        unsigned long now = micros();
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            // Keep every module on a long move
+            if (module_bank.IsParked(i)) {
+                modules[i]->GoToFlapIndex((modules[i]->GetCurrentFlapIndex() + NUM_FLAPS - 1) % NUM_FLAPS);
+                scheduler.Wake(i, now);
+            }
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        scheduler.Update(now);
+        pack_motor_buffer();
+        auto t1 = std::chrono::steady_clock::now();
+
+        // Time decoding by repeating it, which is idempotent given the same previous readings
+        memcpy(previous, sensor_previous_buffer, sizeof(previous));
+        motor_sensor_io();
+        memcpy(sensor_previous_buffer, previous, sizeof(previous));
+        auto t2 = std::chrono::steady_clock::now();
+        decode_sensors();
+        auto t3 = std::chrono::steady_clock::now();
+
+        cpu_nanos += std::chrono::duration_cast<std::chrono::nanoseconds>((t1 - t0) + (t3 - t2)).count();
+        SimClock::advance(std::max(1ul, (unsigned long)bus_micros));
+    }
+    check(homed, "every module finds home before the frame rate estimate");
+    double cpu_micros = homed ? cpu_nanos / 1000.0 / frames : 0;
+
+    printf("\nEstimated update loop frame rate, all modules moving (%u frames)\n\n", frames);
+    printf("%-12s %12s %12s %16s %16s\n", "modules", "cpu us", "bus us", "sync frames/s", "async frames/s");
+    printf("%-12u %12.2f %12.2f %16.0f %16.0f\n", NUM_MODULES, cpu_micros, bus_micros,
+            1e6 / (cpu_micros + bus_micros), 1e6 / std::max(cpu_micros, bus_micros));
+
+    SimHardware::attach(nullptr);
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = argc > 1 ? atoi(argv[1]) : 100000;
+
+    runMappingChecks();
+    runDiscoveryChecks();
+    runFaultChecks();
+    runThroughput(frames);
+    runPipelineEstimate(frames);
+
+    printf("\n%u failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+// Minimal host-native stand-in for the Arduino core, providing just enough of the API for the splitflap module
+// driver (Splitflap/src) to compile and run on a desktop machine for simulation and benchmarking.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+#include "sim_clock.h"
+#include "sim_hardware.h"
+
+// Lets shared code pick the host build's I/O (see Splitflap/src/spi_io_config.h)
+#define SPLITFLAP_NATIVE_SHIM
+
+#define PROGMEM
+#define pgm_read_byte_near(address) (*(const uint8_t*)(address))
+#define pgm_read_word_near(address) (*(const uint16_t*)(address))
+
+// Subset of Arduino's binary.h constants that are used by the module driver
+#define B00000001 1
+#define B00000010 2
+#define B00000100 4
+#define B00001000 8
+#define B00010000 16
+#define B00100000 32
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT  0x0
+#define OUTPUT 0x1
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+
+inline unsigned long micros() {
+    return SimClock::micros();
+}
+
+inline unsigned long millis() {
+    return SimClock::micros() / 1000;
+}
+
+inline void delayMicroseconds(unsigned int us) {
+    SimClock::sleep(us);
+}
+
+inline void delay(unsigned long ms) {
+    SimClock::sleep(ms * 1000);
+}
+
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+
+inline void digitalWrite(uint8_t pin, uint8_t value) {
+    if (SimHardware::attached() != nullptr) {
+        SimHardware::attached()->digitalWrite(pin, value);
+    }
+}
+
+class String {
+    public:
+        String(const char* str = "") : str_(str) {}
+        const char* c_str() const { return str_.c_str(); }
+
+    private:
+        std::string str_;
+};
+
+class HardwareSerial {
+    public:
+        void begin(unsigned long baud) {}
+        void flush() { fflush(stdout); }
+
+        size_t print(const char* str) { return printf("%s", str); }
+        size_t print(const String& str) { return print(str.c_str()); }
+        size_t print(char c) { return printf("%c", c); }
+        size_t print(int n) { return printf("%d", n); }
+        size_t print(unsigned int n) { return printf("%u", n); }
+        size_t print(long n) { return printf("%ld", n); }
+        size_t print(unsigned long n) { return printf("%lu", n); }
+
+        template <typename T>
+        size_t println(T value) { return print(value) + print('\n'); }
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,56 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+// Host-native stand-in for the Arduino SPI library, forwarding transfers to the attached SimHardware
+
+#include <stdint.h>
+
+#include "Arduino.h"
+
+#define MSBFIRST 1
+#define SPI_MODE0 0x00
+
+class SPISettings {
+    public:
+        SPISettings(uint32_t clock, uint8_t bit_order, uint8_t data_mode) : clock_(clock) {}
+        uint32_t clock() const { return clock_; }
+
+    private:
+        uint32_t clock_;
+};
+
+class SPIClass {
+    public:
+        void begin() {}
+        void beginTransaction(SPISettings settings) { clock_ = settings.clock(); }
+        void endTransaction() {}
+
+        uint8_t transfer(uint8_t data) {
+            bytes_transferred_++;
+            return SimHardware::attached() != nullptr ? SimHardware::attached()->transfer(data) : 0;
+        }
+
+        // Clock rate of the current transaction, and bytes transferred so far, for modeling bus time
+        uint32_t clock() const { return clock_; }
+        uint64_t bytesTransferred() const { return bytes_transferred_; }
+
+    private:
+        uint32_t clock_ = 0;
+        uint64_t bytes_transferred_ = 0;
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,64 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <chrono>
+
+/**
+ * Time source backing the native micros()/millis() shims.
+ *
+ * In real-time mode the clock follows the host's monotonic clock, which is what you want when measuring how long
+ * code takes to run. In virtual mode time only moves when advance() is called (or when something calls delay()),
+ * which lets a simulation fast-forward through seconds of motion in a few milliseconds of wall time.
+ */
+namespace SimClock {
+    extern bool real_time_;
+    extern unsigned long virtual_micros_;
+    extern std::chrono::steady_clock::time_point epoch_;
+
+    inline unsigned long micros() {
+        if (real_time_) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch_).count();
+        }
+        return virtual_micros_;
+    }
+
+    // Switches to virtual time, continuing from the current time
+    inline void useVirtualTime() {
+        virtual_micros_ = micros();
+        real_time_ = false;
+    }
+
+    // Switches to real time, continuing from the current time
+    inline void useRealTime() {
+        unsigned long now = micros();
+        epoch_ = std::chrono::steady_clock::now() - std::chrono::microseconds(now);
+        real_time_ = true;
+    }
+
+    inline void advance(unsigned long us) {
+        virtual_micros_ += us;
+    }
+
+    inline void sleep(unsigned long us) {
+        if (real_time_) {
+            unsigned long start = micros();
+            while (micros() - start < us) {}
+        } else {
+            advance(us);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Whatever is wired to the (simulated) GPIO pins and SPI bus, e.g. an emulated shift register chain. The native
+ * digitalWrite() and SPI.transfer() shims forward to the attached hardware; with nothing attached, writes go nowhere
+ * and reads return 0.
+ */
+class SimHardware {
+    public:
+        virtual ~SimHardware() {}
+
+        virtual void digitalWrite(uint8_t pin, uint8_t value) {}
+
+        // Full-duplex transfer of one byte, MSB first
+        virtual uint8_t transfer(uint8_t out) { return 0; }
+
+        static void attach(SimHardware* hardware) { attached_ = hardware; }
+        static SimHardware* attached() { return attached_; }
+
+    private:
+        static SimHardware* attached_;
+};
@@ -746,6 +746,233 @@ export namespace PB {
         }
     }
 
+    /** Properties of a SplitflapTelemetry. */
+    interface ISplitflapTelemetry {
+
+        /** SplitflapTelemetry modules */
+        modules?: (PB.SplitflapTelemetry.IModuleTelemetry[]|null);
+
+        /** SplitflapTelemetry ioFramesPerSecond */
+        ioFramesPerSecond?: (number|null);
+
+        /** SplitflapTelemetry ioIdle */
+        ioIdle?: (boolean|null);
+
+        /** SplitflapTelemetry loopbackCheckMillis */
+        loopbackCheckMillis?: (number|null);
+    }
+
+    /**
+     * Long-term statistics on how reliably each module finds home, for spotting motors that are
+     * starting to lose steps or home sensors that are getting noisy before they cause errors on the
+     * display, and on the driver itself. Sent in response to RequestTelemetry.
+     */
+    class SplitflapTelemetry implements ISplitflapTelemetry {
+
+        /**
+         * Constructs a new SplitflapTelemetry.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.ISplitflapTelemetry);
+
+        /** SplitflapTelemetry modules. */
+        public modules: PB.SplitflapTelemetry.IModuleTelemetry[];
+
+        /** SplitflapTelemetry ioFramesPerSecond. */
+        public ioFramesPerSecond: number;
+
+        /** SplitflapTelemetry ioIdle. */
+        public ioIdle: boolean;
+
+        /** SplitflapTelemetry loopbackCheckMillis. */
+        public loopbackCheckMillis: number;
+
+        /**
+         * Creates a new SplitflapTelemetry instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns SplitflapTelemetry instance
+         */
+        public static create(properties?: PB.ISplitflapTelemetry): PB.SplitflapTelemetry;
+
+        /**
+         * Encodes the specified SplitflapTelemetry message. Does not implicitly {@link PB.SplitflapTelemetry.verify|verify} messages.
+         * @param message SplitflapTelemetry message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.ISplitflapTelemetry, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified SplitflapTelemetry message, length delimited. Does not implicitly {@link PB.SplitflapTelemetry.verify|verify} messages.
+         * @param message SplitflapTelemetry message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.ISplitflapTelemetry, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a SplitflapTelemetry message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns SplitflapTelemetry
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapTelemetry;
+
+        /**
+         * Decodes a SplitflapTelemetry message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns SplitflapTelemetry
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapTelemetry;
+
+        /**
+         * Verifies a SplitflapTelemetry message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a SplitflapTelemetry message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns SplitflapTelemetry
+         */
+        public static fromObject(object: { [k: string]: any }): PB.SplitflapTelemetry;
+
+        /**
+         * Creates a plain object from a SplitflapTelemetry message. Also converts values to other types if specified.
+         * @param message SplitflapTelemetry
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.SplitflapTelemetry, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this SplitflapTelemetry to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace SplitflapTelemetry {
+
+        /** Properties of a ModuleTelemetry. */
+        interface IModuleTelemetry {
+
+            /**
+             * Home blips seen where home was expected, by error in steps relative to the expected home
+             * position. The middle bin counts exact hits, and bins either side count errors of 1-2,
+             * 3-6 and 7 or more steps; early (negative) errors come first. Counts saturate rather than
+             * wrapping.
+             */
+            homeErrorHistogram?: (number[]|null);
+
+            /** ModuleTelemetry recoveries */
+            recoveries?: (number|null);
+
+            /** ModuleTelemetry millisSinceLastError */
+            millisSinceLastError?: (number|null);
+        }
+
+        /** Represents a ModuleTelemetry. */
+        class ModuleTelemetry implements IModuleTelemetry {
+
+            /**
+             * Constructs a new ModuleTelemetry.
+             * @param [properties] Properties to set
+             */
+            constructor(properties?: PB.SplitflapTelemetry.IModuleTelemetry);
+
+            /**
+             * Home blips seen where home was expected, by error in steps relative to the expected home
+             * position. The middle bin counts exact hits, and bins either side count errors of 1-2,
+             * 3-6 and 7 or more steps; early (negative) errors come first. Counts saturate rather than
+             * wrapping.
+             */
+            public homeErrorHistogram: number[];
+
+            /** ModuleTelemetry recoveries. */
+            public recoveries: number;
+
+            /** ModuleTelemetry millisSinceLastError. */
+            public millisSinceLastError: number;
+
+            /**
+             * Creates a new ModuleTelemetry instance using the specified properties.
+             * @param [properties] Properties to set
+             * @returns ModuleTelemetry instance
+             */
+            public static create(properties?: PB.SplitflapTelemetry.IModuleTelemetry): PB.SplitflapTelemetry.ModuleTelemetry;
+
+            /**
+             * Encodes the specified ModuleTelemetry message. Does not implicitly {@link PB.SplitflapTelemetry.ModuleTelemetry.verify|verify} messages.
+             * @param message ModuleTelemetry message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encode(message: PB.SplitflapTelemetry.IModuleTelemetry, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Encodes the specified ModuleTelemetry message, length delimited. Does not implicitly {@link PB.SplitflapTelemetry.ModuleTelemetry.verify|verify} messages.
+             * @param message ModuleTelemetry message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encodeDelimited(message: PB.SplitflapTelemetry.IModuleTelemetry, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Decodes a ModuleTelemetry message from the specified reader or buffer.
+             * @param reader Reader or buffer to decode from
+             * @param [length] Message length if known beforehand
+             * @returns ModuleTelemetry
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapTelemetry.ModuleTelemetry;
+
+            /**
+             * Decodes a ModuleTelemetry message from the specified reader or buffer, length delimited.
+             * @param reader Reader or buffer to decode from
+             * @returns ModuleTelemetry
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapTelemetry.ModuleTelemetry;
+
+            /**
+             * Verifies a ModuleTelemetry message.
+             * @param message Plain object to verify
+             * @returns `null` if valid, otherwise the reason why it is not
+             */
+            public static verify(message: { [k: string]: any }): (string|null);
+
+            /**
+             * Creates a ModuleTelemetry message from a plain object. Also converts values to their respective internal types.
+             * @param object Plain object
+             * @returns ModuleTelemetry
+             */
+            public static fromObject(object: { [k: string]: any }): PB.SplitflapTelemetry.ModuleTelemetry;
+
+            /**
+             * Creates a plain object from a ModuleTelemetry message. Also converts values to other types if specified.
+             * @param message ModuleTelemetry
+             * @param [options] Conversion options
+             * @returns Plain object
+             */
+            public static toObject(message: PB.SplitflapTelemetry.ModuleTelemetry, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+            /**
+             * Converts this ModuleTelemetry to JSON.
+             * @returns JSON object
+             */
+            public toJSON(): { [k: string]: any };
+        }
+    }
+
     /** Properties of a FromSplitflap. */
     interface IFromSplitflap {
 
@@ -760,6 +987,9 @@ export namespace PB {
 
         /** FromSplitflap supervisorState */
         supervisorState?: (PB.ISupervisorState|null);
+
+        /** FromSplitflap splitflapTelemetry */
+        splitflapTelemetry?: (PB.ISplitflapTelemetry|null);
     }
 
     /** Represents a FromSplitflap. */
@@ -783,8 +1013,11 @@ export namespace PB {
         /** FromSplitflap supervisorState. */
         public supervisorState?: (PB.ISupervisorState|null);
 
+        /** FromSplitflap splitflapTelemetry. */
+        public splitflapTelemetry?: (PB.ISplitflapTelemetry|null);
+
         /** FromSplitflap payload. */
-        public payload?: ("splitflapState"|"log"|"ack"|"supervisorState");
+        public payload?: ("splitflapState"|"log"|"ack"|"supervisorState"|"splitflapTelemetry");
 
         /**
          * Creates a new FromSplitflap instance using the specified properties.
@@ -857,6 +1090,17 @@ export namespace PB {
         public toJSON(): { [k: string]: any };
     }
 
+    /**
+     * Acceleration/velocity profile used when moving a module to a new flap. Homing always uses
+     * MOTION_PROFILE_DEFAULT.
+     */
+    enum MotionProfile {
+        MOTION_PROFILE_DEFAULT = 0,
+        MOTION_PROFILE_QUIET = 1,
+        MOTION_PROFILE_S_CURVE = 2,
+        MOTION_PROFILE_S_CURVE_FAST = 3
+    }
+
     /** Properties of a SplitflapCommand. */
     interface ISplitflapCommand {
 
@@ -957,6 +1201,9 @@ export namespace PB {
 
             /** ModuleCommand param */
             param?: (number|null);
+
+            /** ModuleCommand motionProfile */
+            motionProfile?: (PB.MotionProfile|null);
         }
 
         /** Represents a ModuleCommand. */
@@ -974,6 +1221,9 @@ export namespace PB {
             /** ModuleCommand param. */
             public param: number;
 
+            /** ModuleCommand motionProfile. */
+            public motionProfile: PB.MotionProfile;
+
             /**
              * Creates a new ModuleCommand instance using the specified properties.
              * @param [properties] Properties to set
@@ -1171,6 +1421,12 @@ export namespace PB {
              * NOTE: Must be < 256
              */
             resetNonce?: (number|null);
+
+            /**
+             * Profile for movements of this module. A change only takes effect once the module is
+             * next at rest.
+             */
+            motionProfile?: (PB.MotionProfile|null);
         }
 
         /** Represents a ModuleConfig. */
@@ -1203,6 +1459,12 @@ export namespace PB {
              */
             public resetNonce: number;
 
+            /**
+             * Profile for movements of this module. A change only takes effect once the module is
+             * next at rest.
+             */
+            public motionProfile: PB.MotionProfile;
+
             /**
              * Creates a new ModuleConfig instance using the specified properties.
              * @param [properties] Properties to set
@@ -1275,6 +1537,567 @@ export namespace PB {
         }
     }
 
+    /** Properties of a SplitflapSequence. */
+    interface ISplitflapSequence {
+
+        /** SplitflapSequence modules */
+        modules?: (PB.SplitflapSequence.IModuleSequence[]|null);
+
+        /** SplitflapSequence dwellMillis */
+        dwellMillis?: (number|null);
+    }
+
+    /**
+     * Queues up a sequence of flaps for each module to show in turn. Each module moves on to its
+     * next flap as soon as it has shown the previous one for dwell_millis, independently of the
+     * other modules.
+     */
+    class SplitflapSequence implements ISplitflapSequence {
+
+        /**
+         * Constructs a new SplitflapSequence.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.ISplitflapSequence);
+
+        /** SplitflapSequence modules. */
+        public modules: PB.SplitflapSequence.IModuleSequence[];
+
+        /** SplitflapSequence dwellMillis. */
+        public dwellMillis: number;
+
+        /**
+         * Creates a new SplitflapSequence instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns SplitflapSequence instance
+         */
+        public static create(properties?: PB.ISplitflapSequence): PB.SplitflapSequence;
+
+        /**
+         * Encodes the specified SplitflapSequence message. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+         * @param message SplitflapSequence message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.ISplitflapSequence, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified SplitflapSequence message, length delimited. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+         * @param message SplitflapSequence message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.ISplitflapSequence, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a SplitflapSequence message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns SplitflapSequence
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapSequence;
+
+        /**
+         * Decodes a SplitflapSequence message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns SplitflapSequence
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapSequence;
+
+        /**
+         * Verifies a SplitflapSequence message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a SplitflapSequence message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns SplitflapSequence
+         */
+        public static fromObject(object: { [k: string]: any }): PB.SplitflapSequence;
+
+        /**
+         * Creates a plain object from a SplitflapSequence message. Also converts values to other types if specified.
+         * @param message SplitflapSequence
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.SplitflapSequence, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this SplitflapSequence to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace SplitflapSequence {
+
+        /** Properties of a ModuleSequence. */
+        interface IModuleSequence {
+
+            /**
+             * Flap indices to show, in order. These are added after any flaps still pending from a
+             * previous sequence; any other command for the module clears them.
+             */
+            flapIndices?: (Uint8Array|null);
+        }
+
+        /** Represents a ModuleSequence. */
+        class ModuleSequence implements IModuleSequence {
+
+            /**
+             * Constructs a new ModuleSequence.
+             * @param [properties] Properties to set
+             */
+            constructor(properties?: PB.SplitflapSequence.IModuleSequence);
+
+            /**
+             * Flap indices to show, in order. These are added after any flaps still pending from a
+             * previous sequence; any other command for the module clears them.
+             */
+            public flapIndices: Uint8Array;
+
+            /**
+             * Creates a new ModuleSequence instance using the specified properties.
+             * @param [properties] Properties to set
+             * @returns ModuleSequence instance
+             */
+            public static create(properties?: PB.SplitflapSequence.IModuleSequence): PB.SplitflapSequence.ModuleSequence;
+
+            /**
+             * Encodes the specified ModuleSequence message. Does not implicitly {@link PB.SplitflapSequence.ModuleSequence.verify|verify} messages.
+             * @param message ModuleSequence message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encode(message: PB.SplitflapSequence.IModuleSequence, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Encodes the specified ModuleSequence message, length delimited. Does not implicitly {@link PB.SplitflapSequence.ModuleSequence.verify|verify} messages.
+             * @param message ModuleSequence message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encodeDelimited(message: PB.SplitflapSequence.IModuleSequence, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Decodes a ModuleSequence message from the specified reader or buffer.
+             * @param reader Reader or buffer to decode from
+             * @param [length] Message length if known beforehand
+             * @returns ModuleSequence
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapSequence.ModuleSequence;
+
+            /**
+             * Decodes a ModuleSequence message from the specified reader or buffer, length delimited.
+             * @param reader Reader or buffer to decode from
+             * @returns ModuleSequence
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapSequence.ModuleSequence;
+
+            /**
+             * Verifies a ModuleSequence message.
+             * @param message Plain object to verify
+             * @returns `null` if valid, otherwise the reason why it is not
+             */
+            public static verify(message: { [k: string]: any }): (string|null);
+
+            /**
+             * Creates a ModuleSequence message from a plain object. Also converts values to their respective internal types.
+             * @param object Plain object
+             * @returns ModuleSequence
+             */
+            public static fromObject(object: { [k: string]: any }): PB.SplitflapSequence.ModuleSequence;
+
+            /**
+             * Creates a plain object from a ModuleSequence message. Also converts values to other types if specified.
+             * @param message ModuleSequence
+             * @param [options] Conversion options
+             * @returns Plain object
+             */
+            public static toObject(message: PB.SplitflapSequence.ModuleSequence, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+            /**
+             * Converts this ModuleSequence to JSON.
+             * @returns JSON object
+             */
+            public toJSON(): { [k: string]: any };
+        }
+    }
+
+    /** Properties of a SplitflapCharacterSets. */
+    interface ISplitflapCharacterSets {
+
+        /** SplitflapCharacterSets characterSets */
+        characterSets?: (PB.SplitflapCharacterSets.ICharacterSet[]|null);
+
+        /** SplitflapCharacterSets moduleCharacterSets */
+        moduleCharacterSets?: (Uint8Array|null);
+    }
+
+    /**
+     * Replaces the character sets used to find the flap showing a given character (e.g. for text sent
+     * via MQTT or the legacy serial protocol), and assigns one to each module, so that modules with
+     * different flaps (letters, digits, colors) can share a display. Saved to flash, so it persists
+     * across restarts.
+     */
+    class SplitflapCharacterSets implements ISplitflapCharacterSets {
+
+        /**
+         * Constructs a new SplitflapCharacterSets.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.ISplitflapCharacterSets);
+
+        /** SplitflapCharacterSets characterSets. */
+        public characterSets: PB.SplitflapCharacterSets.ICharacterSet[];
+
+        /** SplitflapCharacterSets moduleCharacterSets. */
+        public moduleCharacterSets: Uint8Array;
+
+        /**
+         * Creates a new SplitflapCharacterSets instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns SplitflapCharacterSets instance
+         */
+        public static create(properties?: PB.ISplitflapCharacterSets): PB.SplitflapCharacterSets;
+
+        /**
+         * Encodes the specified SplitflapCharacterSets message. Does not implicitly {@link PB.SplitflapCharacterSets.verify|verify} messages.
+         * @param message SplitflapCharacterSets message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.ISplitflapCharacterSets, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified SplitflapCharacterSets message, length delimited. Does not implicitly {@link PB.SplitflapCharacterSets.verify|verify} messages.
+         * @param message SplitflapCharacterSets message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.ISplitflapCharacterSets, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a SplitflapCharacterSets message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns SplitflapCharacterSets
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapCharacterSets;
+
+        /**
+         * Decodes a SplitflapCharacterSets message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns SplitflapCharacterSets
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapCharacterSets;
+
+        /**
+         * Verifies a SplitflapCharacterSets message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a SplitflapCharacterSets message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns SplitflapCharacterSets
+         */
+        public static fromObject(object: { [k: string]: any }): PB.SplitflapCharacterSets;
+
+        /**
+         * Creates a plain object from a SplitflapCharacterSets message. Also converts values to other types if specified.
+         * @param message SplitflapCharacterSets
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.SplitflapCharacterSets, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this SplitflapCharacterSets to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace SplitflapCharacterSets {
+
+        /** Properties of a CharacterSet. */
+        interface ICharacterSet {
+
+            /** CharacterSet flaps */
+            flaps?: (Uint8Array|null);
+        }
+
+        /** Represents a CharacterSet. */
+        class CharacterSet implements ICharacterSet {
+
+            /**
+             * Constructs a new CharacterSet.
+             * @param [properties] Properties to set
+             */
+            constructor(properties?: PB.SplitflapCharacterSets.ICharacterSet);
+
+            /** CharacterSet flaps. */
+            public flaps: Uint8Array;
+
+            /**
+             * Creates a new CharacterSet instance using the specified properties.
+             * @param [properties] Properties to set
+             * @returns CharacterSet instance
+             */
+            public static create(properties?: PB.SplitflapCharacterSets.ICharacterSet): PB.SplitflapCharacterSets.CharacterSet;
+
+            /**
+             * Encodes the specified CharacterSet message. Does not implicitly {@link PB.SplitflapCharacterSets.CharacterSet.verify|verify} messages.
+             * @param message CharacterSet message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encode(message: PB.SplitflapCharacterSets.ICharacterSet, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Encodes the specified CharacterSet message, length delimited. Does not implicitly {@link PB.SplitflapCharacterSets.CharacterSet.verify|verify} messages.
+             * @param message CharacterSet message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encodeDelimited(message: PB.SplitflapCharacterSets.ICharacterSet, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Decodes a CharacterSet message from the specified reader or buffer.
+             * @param reader Reader or buffer to decode from
+             * @param [length] Message length if known beforehand
+             * @returns CharacterSet
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapCharacterSets.CharacterSet;
+
+            /**
+             * Decodes a CharacterSet message from the specified reader or buffer, length delimited.
+             * @param reader Reader or buffer to decode from
+             * @returns CharacterSet
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapCharacterSets.CharacterSet;
+
+            /**
+             * Verifies a CharacterSet message.
+             * @param message Plain object to verify
+             * @returns `null` if valid, otherwise the reason why it is not
+             */
+            public static verify(message: { [k: string]: any }): (string|null);
+
+            /**
+             * Creates a CharacterSet message from a plain object. Also converts values to their respective internal types.
+             * @param object Plain object
+             * @returns CharacterSet
+             */
+            public static fromObject(object: { [k: string]: any }): PB.SplitflapCharacterSets.CharacterSet;
+
+            /**
+             * Creates a plain object from a CharacterSet message. Also converts values to other types if specified.
+             * @param message CharacterSet
+             * @param [options] Conversion options
+             * @returns Plain object
+             */
+            public static toObject(message: PB.SplitflapCharacterSets.CharacterSet, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+            /**
+             * Converts this CharacterSet to JSON.
+             * @returns JSON object
+             */
+            public toJSON(): { [k: string]: any };
+        }
+    }
+
+    /** Properties of a RequestState. */
+    interface IRequestState {
+    }
+
+    /** Represents a RequestState. */
+    class RequestState implements IRequestState {
+
+        /**
+         * Constructs a new RequestState.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IRequestState);
+
+        /**
+         * Creates a new RequestState instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns RequestState instance
+         */
+        public static create(properties?: PB.IRequestState): PB.RequestState;
+
+        /**
+         * Encodes the specified RequestState message. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+         * @param message RequestState message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IRequestState, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified RequestState message, length delimited. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+         * @param message RequestState message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IRequestState, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a RequestState message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns RequestState
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.RequestState;
+
+        /**
+         * Decodes a RequestState message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns RequestState
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.RequestState;
+
+        /**
+         * Verifies a RequestState message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a RequestState message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns RequestState
+         */
+        public static fromObject(object: { [k: string]: any }): PB.RequestState;
+
+        /**
+         * Creates a plain object from a RequestState message. Also converts values to other types if specified.
+         * @param message RequestState
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.RequestState, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this RequestState to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    /** Properties of a RequestTelemetry. */
+    interface IRequestTelemetry {
+    }
+
+    /** Represents a RequestTelemetry. */
+    class RequestTelemetry implements IRequestTelemetry {
+
+        /**
+         * Constructs a new RequestTelemetry.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IRequestTelemetry);
+
+        /**
+         * Creates a new RequestTelemetry instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns RequestTelemetry instance
+         */
+        public static create(properties?: PB.IRequestTelemetry): PB.RequestTelemetry;
+
+        /**
+         * Encodes the specified RequestTelemetry message. Does not implicitly {@link PB.RequestTelemetry.verify|verify} messages.
+         * @param message RequestTelemetry message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IRequestTelemetry, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified RequestTelemetry message, length delimited. Does not implicitly {@link PB.RequestTelemetry.verify|verify} messages.
+         * @param message RequestTelemetry message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IRequestTelemetry, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a RequestTelemetry message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns RequestTelemetry
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.RequestTelemetry;
+
+        /**
+         * Decodes a RequestTelemetry message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns RequestTelemetry
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.RequestTelemetry;
+
+        /**
+         * Verifies a RequestTelemetry message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a RequestTelemetry message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns RequestTelemetry
+         */
+        public static fromObject(object: { [k: string]: any }): PB.RequestTelemetry;
+
+        /**
+         * Creates a plain object from a RequestTelemetry message. Also converts values to other types if specified.
+         * @param message RequestTelemetry
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.RequestTelemetry, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this RequestTelemetry to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
     /** Properties of a ToSplitflap. */
     interface IToSplitflap {
 
@@ -1286,6 +2109,18 @@ export namespace PB {
 
         /** ToSplitflap splitflapConfig */
         splitflapConfig?: (PB.ISplitflapConfig|null);
+
+        /** ToSplitflap requestState */
+        requestState?: (PB.IRequestState|null);
+
+        /** ToSplitflap splitflapSequence */
+        splitflapSequence?: (PB.ISplitflapSequence|null);
+
+        /** ToSplitflap splitflapCharacterSets */
+        splitflapCharacterSets?: (PB.ISplitflapCharacterSets|null);
+
+        /** ToSplitflap requestTelemetry */
+        requestTelemetry?: (PB.IRequestTelemetry|null);
     }
 
     /** Represents a ToSplitflap. */
@@ -1306,8 +2141,20 @@ export namespace PB {
         /** ToSplitflap splitflapConfig. */
         public splitflapConfig?: (PB.ISplitflapConfig|null);
 
+        /** ToSplitflap requestState. */
+        public requestState?: (PB.IRequestState|null);
+
+        /** ToSplitflap splitflapSequence. */
+        public splitflapSequence?: (PB.ISplitflapSequence|null);
+
+        /** ToSplitflap splitflapCharacterSets. */
+        public splitflapCharacterSets?: (PB.ISplitflapCharacterSets|null);
+
+        /** ToSplitflap requestTelemetry. */
+        public requestTelemetry?: (PB.IRequestTelemetry|null);
+
         /** ToSplitflap payload. */
-        public payload?: ("splitflapCommand"|"splitflapConfig");
+        public payload?: ("splitflapCommand"|"splitflapConfig"|"requestState"|"splitflapSequence"|"splitflapCharacterSets"|"requestTelemetry");
 
         /**
          * Creates a new ToSplitflap instance using the specified properties.
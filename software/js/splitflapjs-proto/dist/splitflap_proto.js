@@ -1815,27 +1815,30 @@
             return SupervisorState;
         })();
     
-        PB.FromSplitflap = (function() {
+        PB.SplitflapTelemetry = (function() {
     
             /**
-             * Properties of a FromSplitflap.
+             * Properties of a SplitflapTelemetry.
              * @memberof PB
-             * @interface IFromSplitflap
-             * @property {PB.ISplitflapState|null} [splitflapState] FromSplitflap splitflapState
-             * @property {PB.ILog|null} [log] FromSplitflap log
-             * @property {PB.IAck|null} [ack] FromSplitflap ack
-             * @property {PB.ISupervisorState|null} [supervisorState] FromSplitflap supervisorState
+             * @interface ISplitflapTelemetry
+             * @property {Array.<PB.SplitflapTelemetry.IModuleTelemetry>|null} [modules] SplitflapTelemetry modules
+             * @property {number|null} [ioFramesPerSecond] SplitflapTelemetry ioFramesPerSecond
+             * @property {boolean|null} [ioIdle] SplitflapTelemetry ioIdle
+             * @property {number|null} [loopbackCheckMillis] SplitflapTelemetry loopbackCheckMillis
              */
     
             /**
-             * Constructs a new FromSplitflap.
+             * Constructs a new SplitflapTelemetry.
              * @memberof PB
-             * @classdesc Represents a FromSplitflap.
-             * @implements IFromSplitflap
+             * @classdesc Long-term statistics on how reliably each module finds home, for spotting motors that are
+             * starting to lose steps or home sensors that are getting noisy before they cause errors on the
+             * display, and on the driver itself. Sent in response to RequestTelemetry.
+             * @implements ISplitflapTelemetry
              * @constructor
-             * @param {PB.IFromSplitflap=} [properties] Properties to set
+             * @param {PB.ISplitflapTelemetry=} [properties] Properties to set
              */
-            function FromSplitflap(properties) {
+            function SplitflapTelemetry(properties) {
+                this.modules = [];
                 if (properties)
                     for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                         if (properties[keys[i]] != null)
@@ -1843,128 +1846,117 @@
             }
     
             /**
-             * FromSplitflap splitflapState.
-             * @member {PB.ISplitflapState|null|undefined} splitflapState
-             * @memberof PB.FromSplitflap
-             * @instance
-             */
-            FromSplitflap.prototype.splitflapState = null;
-    
-            /**
-             * FromSplitflap log.
-             * @member {PB.ILog|null|undefined} log
-             * @memberof PB.FromSplitflap
+             * SplitflapTelemetry modules.
+             * @member {Array.<PB.SplitflapTelemetry.IModuleTelemetry>} modules
+             * @memberof PB.SplitflapTelemetry
              * @instance
              */
-            FromSplitflap.prototype.log = null;
+            SplitflapTelemetry.prototype.modules = $util.emptyArray;
     
             /**
-             * FromSplitflap ack.
-             * @member {PB.IAck|null|undefined} ack
-             * @memberof PB.FromSplitflap
+             * SplitflapTelemetry ioFramesPerSecond.
+             * @member {number} ioFramesPerSecond
+             * @memberof PB.SplitflapTelemetry
              * @instance
              */
-            FromSplitflap.prototype.ack = null;
+            SplitflapTelemetry.prototype.ioFramesPerSecond = 0;
     
             /**
-             * FromSplitflap supervisorState.
-             * @member {PB.ISupervisorState|null|undefined} supervisorState
-             * @memberof PB.FromSplitflap
+             * SplitflapTelemetry ioIdle.
+             * @member {boolean} ioIdle
+             * @memberof PB.SplitflapTelemetry
              * @instance
              */
-            FromSplitflap.prototype.supervisorState = null;
-    
-            // OneOf field names bound to virtual getters and setters
-            var $oneOfFields;
+            SplitflapTelemetry.prototype.ioIdle = false;
     
             /**
-             * FromSplitflap payload.
-             * @member {"splitflapState"|"log"|"ack"|"supervisorState"|undefined} payload
-             * @memberof PB.FromSplitflap
+             * SplitflapTelemetry loopbackCheckMillis.
+             * @member {number} loopbackCheckMillis
+             * @memberof PB.SplitflapTelemetry
              * @instance
              */
-            Object.defineProperty(FromSplitflap.prototype, "payload", {
-                get: $util.oneOfGetter($oneOfFields = ["splitflapState", "log", "ack", "supervisorState"]),
-                set: $util.oneOfSetter($oneOfFields)
-            });
+            SplitflapTelemetry.prototype.loopbackCheckMillis = 0;
     
             /**
-             * Creates a new FromSplitflap instance using the specified properties.
+             * Creates a new SplitflapTelemetry instance using the specified properties.
              * @function create
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
-             * @param {PB.IFromSplitflap=} [properties] Properties to set
-             * @returns {PB.FromSplitflap} FromSplitflap instance
+             * @param {PB.ISplitflapTelemetry=} [properties] Properties to set
+             * @returns {PB.SplitflapTelemetry} SplitflapTelemetry instance
              */
-            FromSplitflap.create = function create(properties) {
-                return new FromSplitflap(properties);
+            SplitflapTelemetry.create = function create(properties) {
+                return new SplitflapTelemetry(properties);
             };
     
             /**
-             * Encodes the specified FromSplitflap message. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * Encodes the specified SplitflapTelemetry message. Does not implicitly {@link PB.SplitflapTelemetry.verify|verify} messages.
              * @function encode
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
-             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {PB.ISplitflapTelemetry} message SplitflapTelemetry message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            FromSplitflap.encode = function encode(message, writer) {
+            SplitflapTelemetry.encode = function encode(message, writer) {
                 if (!writer)
                     writer = $Writer.create();
-                if (message.splitflapState != null && Object.hasOwnProperty.call(message, "splitflapState"))
-                    $root.PB.SplitflapState.encode(message.splitflapState, writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
-                if (message.log != null && Object.hasOwnProperty.call(message, "log"))
-                    $root.PB.Log.encode(message.log, writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
-                if (message.ack != null && Object.hasOwnProperty.call(message, "ack"))
-                    $root.PB.Ack.encode(message.ack, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
-                if (message.supervisorState != null && Object.hasOwnProperty.call(message, "supervisorState"))
-                    $root.PB.SupervisorState.encode(message.supervisorState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.modules != null && message.modules.length)
+                    for (var i = 0; i < message.modules.length; ++i)
+                        $root.PB.SplitflapTelemetry.ModuleTelemetry.encode(message.modules[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.ioFramesPerSecond != null && Object.hasOwnProperty.call(message, "ioFramesPerSecond"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.ioFramesPerSecond);
+                if (message.ioIdle != null && Object.hasOwnProperty.call(message, "ioIdle"))
+                    writer.uint32(/* id 3, wireType 0 =*/24).bool(message.ioIdle);
+                if (message.loopbackCheckMillis != null && Object.hasOwnProperty.call(message, "loopbackCheckMillis"))
+                    writer.uint32(/* id 4, wireType 0 =*/32).uint32(message.loopbackCheckMillis);
                 return writer;
             };
     
             /**
-             * Encodes the specified FromSplitflap message, length delimited. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * Encodes the specified SplitflapTelemetry message, length delimited. Does not implicitly {@link PB.SplitflapTelemetry.verify|verify} messages.
              * @function encodeDelimited
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
-             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {PB.ISplitflapTelemetry} message SplitflapTelemetry message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            FromSplitflap.encodeDelimited = function encodeDelimited(message, writer) {
+            SplitflapTelemetry.encodeDelimited = function encodeDelimited(message, writer) {
                 return this.encode(message, writer).ldelim();
             };
     
             /**
-             * Decodes a FromSplitflap message from the specified reader or buffer.
+             * Decodes a SplitflapTelemetry message from the specified reader or buffer.
              * @function decode
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
              * @param {number} [length] Message length if known beforehand
-             * @returns {PB.FromSplitflap} FromSplitflap
+             * @returns {PB.SplitflapTelemetry} SplitflapTelemetry
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            FromSplitflap.decode = function decode(reader, length) {
+            SplitflapTelemetry.decode = function decode(reader, length) {
                 if (!(reader instanceof $Reader))
                     reader = $Reader.create(reader);
-                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.FromSplitflap();
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapTelemetry();
                 while (reader.pos < end) {
                     var tag = reader.uint32();
                     switch (tag >>> 3) {
                     case 1:
-                        message.splitflapState = $root.PB.SplitflapState.decode(reader, reader.uint32());
+                        if (!(message.modules && message.modules.length))
+                            message.modules = [];
+                        message.modules.push($root.PB.SplitflapTelemetry.ModuleTelemetry.decode(reader, reader.uint32()));
                         break;
                     case 2:
-                        message.log = $root.PB.Log.decode(reader, reader.uint32());
+                        message.ioFramesPerSecond = reader.uint32();
                         break;
                     case 3:
-                        message.ack = $root.PB.Ack.decode(reader, reader.uint32());
+                        message.ioIdle = reader.bool();
                         break;
                     case 4:
-                        message.supervisorState = $root.PB.SupervisorState.decode(reader, reader.uint32());
+                        message.loopbackCheckMillis = reader.uint32();
                         break;
                     default:
                         reader.skipType(tag & 7);
@@ -1975,257 +1967,2307 @@
             };
     
             /**
-             * Decodes a FromSplitflap message from the specified reader or buffer, length delimited.
+             * Decodes a SplitflapTelemetry message from the specified reader or buffer, length delimited.
              * @function decodeDelimited
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-             * @returns {PB.FromSplitflap} FromSplitflap
+             * @returns {PB.SplitflapTelemetry} SplitflapTelemetry
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            FromSplitflap.decodeDelimited = function decodeDelimited(reader) {
+            SplitflapTelemetry.decodeDelimited = function decodeDelimited(reader) {
                 if (!(reader instanceof $Reader))
                     reader = new $Reader(reader);
                 return this.decode(reader, reader.uint32());
             };
     
             /**
-             * Verifies a FromSplitflap message.
+             * Verifies a SplitflapTelemetry message.
              * @function verify
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
              * @param {Object.<string,*>} message Plain object to verify
              * @returns {string|null} `null` if valid, otherwise the reason why it is not
              */
-            FromSplitflap.verify = function verify(message) {
+            SplitflapTelemetry.verify = function verify(message) {
                 if (typeof message !== "object" || message === null)
                     return "object expected";
-                var properties = {};
-                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.SplitflapState.verify(message.splitflapState);
-                        if (error)
-                            return "splitflapState." + error;
-                    }
-                }
-                if (message.log != null && message.hasOwnProperty("log")) {
-                    if (properties.payload === 1)
-                        return "payload: multiple values";
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.Log.verify(message.log);
-                        if (error)
-                            return "log." + error;
-                    }
-                }
-                if (message.ack != null && message.hasOwnProperty("ack")) {
-                    if (properties.payload === 1)
-                        return "payload: multiple values";
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.Ack.verify(message.ack);
-                        if (error)
-                            return "ack." + error;
-                    }
-                }
-                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
-                    if (properties.payload === 1)
-                        return "payload: multiple values";
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.SupervisorState.verify(message.supervisorState);
+                if (message.modules != null && message.hasOwnProperty("modules")) {
+                    if (!Array.isArray(message.modules))
+                        return "modules: array expected";
+                    for (var i = 0; i < message.modules.length; ++i) {
+                        var error = $root.PB.SplitflapTelemetry.ModuleTelemetry.verify(message.modules[i]);
                         if (error)
-                            return "supervisorState." + error;
+                            return "modules." + error;
                     }
                 }
+                if (message.ioFramesPerSecond != null && message.hasOwnProperty("ioFramesPerSecond"))
+                    if (!$util.isInteger(message.ioFramesPerSecond))
+                        return "ioFramesPerSecond: integer expected";
+                if (message.ioIdle != null && message.hasOwnProperty("ioIdle"))
+                    if (typeof message.ioIdle !== "boolean")
+                        return "ioIdle: boolean expected";
+                if (message.loopbackCheckMillis != null && message.hasOwnProperty("loopbackCheckMillis"))
+                    if (!$util.isInteger(message.loopbackCheckMillis))
+                        return "loopbackCheckMillis: integer expected";
                 return null;
             };
     
             /**
-             * Creates a FromSplitflap message from a plain object. Also converts values to their respective internal types.
+             * Creates a SplitflapTelemetry message from a plain object. Also converts values to their respective internal types.
              * @function fromObject
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
              * @param {Object.<string,*>} object Plain object
-             * @returns {PB.FromSplitflap} FromSplitflap
+             * @returns {PB.SplitflapTelemetry} SplitflapTelemetry
              */
-            FromSplitflap.fromObject = function fromObject(object) {
-                if (object instanceof $root.PB.FromSplitflap)
+            SplitflapTelemetry.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapTelemetry)
                     return object;
-                var message = new $root.PB.FromSplitflap();
-                if (object.splitflapState != null) {
-                    if (typeof object.splitflapState !== "object")
-                        throw TypeError(".PB.FromSplitflap.splitflapState: object expected");
-                    message.splitflapState = $root.PB.SplitflapState.fromObject(object.splitflapState);
-                }
-                if (object.log != null) {
-                    if (typeof object.log !== "object")
-                        throw TypeError(".PB.FromSplitflap.log: object expected");
-                    message.log = $root.PB.Log.fromObject(object.log);
-                }
-                if (object.ack != null) {
-                    if (typeof object.ack !== "object")
-                        throw TypeError(".PB.FromSplitflap.ack: object expected");
-                    message.ack = $root.PB.Ack.fromObject(object.ack);
-                }
-                if (object.supervisorState != null) {
-                    if (typeof object.supervisorState !== "object")
-                        throw TypeError(".PB.FromSplitflap.supervisorState: object expected");
-                    message.supervisorState = $root.PB.SupervisorState.fromObject(object.supervisorState);
+                var message = new $root.PB.SplitflapTelemetry();
+                if (object.modules) {
+                    if (!Array.isArray(object.modules))
+                        throw TypeError(".PB.SplitflapTelemetry.modules: array expected");
+                    message.modules = [];
+                    for (var i = 0; i < object.modules.length; ++i) {
+                        if (typeof object.modules[i] !== "object")
+                            throw TypeError(".PB.SplitflapTelemetry.modules: object expected");
+                        message.modules[i] = $root.PB.SplitflapTelemetry.ModuleTelemetry.fromObject(object.modules[i]);
+                    }
                 }
+                if (object.ioFramesPerSecond != null)
+                    message.ioFramesPerSecond = object.ioFramesPerSecond >>> 0;
+                if (object.ioIdle != null)
+                    message.ioIdle = Boolean(object.ioIdle);
+                if (object.loopbackCheckMillis != null)
+                    message.loopbackCheckMillis = object.loopbackCheckMillis >>> 0;
                 return message;
             };
     
             /**
-             * Creates a plain object from a FromSplitflap message. Also converts values to other types if specified.
+             * Creates a plain object from a SplitflapTelemetry message. Also converts values to other types if specified.
              * @function toObject
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @static
-             * @param {PB.FromSplitflap} message FromSplitflap
+             * @param {PB.SplitflapTelemetry} message SplitflapTelemetry
              * @param {$protobuf.IConversionOptions} [options] Conversion options
              * @returns {Object.<string,*>} Plain object
              */
-            FromSplitflap.toObject = function toObject(message, options) {
+            SplitflapTelemetry.toObject = function toObject(message, options) {
                 if (!options)
                     options = {};
                 var object = {};
-                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
-                    object.splitflapState = $root.PB.SplitflapState.toObject(message.splitflapState, options);
-                    if (options.oneofs)
-                        object.payload = "splitflapState";
-                }
-                if (message.log != null && message.hasOwnProperty("log")) {
-                    object.log = $root.PB.Log.toObject(message.log, options);
-                    if (options.oneofs)
-                        object.payload = "log";
-                }
-                if (message.ack != null && message.hasOwnProperty("ack")) {
-                    object.ack = $root.PB.Ack.toObject(message.ack, options);
-                    if (options.oneofs)
-                        object.payload = "ack";
+                if (options.arrays || options.defaults)
+                    object.modules = [];
+                if (options.defaults) {
+                    object.ioFramesPerSecond = 0;
+                    object.ioIdle = false;
+                    object.loopbackCheckMillis = 0;
                 }
-                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
-                    object.supervisorState = $root.PB.SupervisorState.toObject(message.supervisorState, options);
-                    if (options.oneofs)
-                        object.payload = "supervisorState";
+                if (message.modules && message.modules.length) {
+                    object.modules = [];
+                    for (var j = 0; j < message.modules.length; ++j)
+                        object.modules[j] = $root.PB.SplitflapTelemetry.ModuleTelemetry.toObject(message.modules[j], options);
                 }
+                if (message.ioFramesPerSecond != null && message.hasOwnProperty("ioFramesPerSecond"))
+                    object.ioFramesPerSecond = message.ioFramesPerSecond;
+                if (message.ioIdle != null && message.hasOwnProperty("ioIdle"))
+                    object.ioIdle = message.ioIdle;
+                if (message.loopbackCheckMillis != null && message.hasOwnProperty("loopbackCheckMillis"))
+                    object.loopbackCheckMillis = message.loopbackCheckMillis;
                 return object;
             };
     
             /**
-             * Converts this FromSplitflap to JSON.
+             * Converts this SplitflapTelemetry to JSON.
              * @function toJSON
-             * @memberof PB.FromSplitflap
+             * @memberof PB.SplitflapTelemetry
              * @instance
              * @returns {Object.<string,*>} JSON object
              */
-            FromSplitflap.prototype.toJSON = function toJSON() {
+            SplitflapTelemetry.prototype.toJSON = function toJSON() {
                 return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
             };
     
-            return FromSplitflap;
-        })();
+            SplitflapTelemetry.ModuleTelemetry = (function() {
     
-        PB.SplitflapCommand = (function() {
+                /**
+                 * Properties of a ModuleTelemetry.
+                 * @memberof PB.SplitflapTelemetry
+                 * @interface IModuleTelemetry
+                 * @property {Array.<number>|null} [homeErrorHistogram] Home blips seen where home was expected, by error in steps relative to the expected home
+                 * position. The middle bin counts exact hits, and bins either side count errors of 1-2,
+                 * 3-6 and 7 or more steps; early (negative) errors come first. Counts saturate rather than
+                 * wrapping.
+                 * @property {number|null} [recoveries] ModuleTelemetry recoveries
+                 * @property {number|null} [millisSinceLastError] ModuleTelemetry millisSinceLastError
+                 */
     
-            /**
-             * Properties of a SplitflapCommand.
-             * @memberof PB
-             * @interface ISplitflapCommand
-             * @property {Array.<PB.SplitflapCommand.IModuleCommand>|null} [modules] SplitflapCommand modules
-             */
+                /**
+                 * Constructs a new ModuleTelemetry.
+                 * @memberof PB.SplitflapTelemetry
+                 * @classdesc Represents a ModuleTelemetry.
+                 * @implements IModuleTelemetry
+                 * @constructor
+                 * @param {PB.SplitflapTelemetry.IModuleTelemetry=} [properties] Properties to set
+                 */
+                function ModuleTelemetry(properties) {
+                    this.homeErrorHistogram = [];
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
     
-            /**
-             * Constructs a new SplitflapCommand.
-             * @memberof PB
-             * @classdesc Represents a SplitflapCommand.
-             * @implements ISplitflapCommand
-             * @constructor
-             * @param {PB.ISplitflapCommand=} [properties] Properties to set
-             */
-            function SplitflapCommand(properties) {
-                this.modules = [];
-                if (properties)
-                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
-                        if (properties[keys[i]] != null)
-                            this[keys[i]] = properties[keys[i]];
-            }
+                /**
+                 * Home blips seen where home was expected, by error in steps relative to the expected home
+                 * position. The middle bin counts exact hits, and bins either side count errors of 1-2,
+                 * 3-6 and 7 or more steps; early (negative) errors come first. Counts saturate rather than
+                 * wrapping.
+                 * @member {Array.<number>} homeErrorHistogram
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @instance
+                 */
+                ModuleTelemetry.prototype.homeErrorHistogram = $util.emptyArray;
     
-            /**
-             * SplitflapCommand modules.
-             * @member {Array.<PB.SplitflapCommand.IModuleCommand>} modules
-             * @memberof PB.SplitflapCommand
-             * @instance
-             */
-            SplitflapCommand.prototype.modules = $util.emptyArray;
+                /**
+                 * ModuleTelemetry recoveries.
+                 * @member {number} recoveries
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @instance
+                 */
+                ModuleTelemetry.prototype.recoveries = 0;
     
-            /**
-             * Creates a new SplitflapCommand instance using the specified properties.
-             * @function create
-             * @memberof PB.SplitflapCommand
-             * @static
-             * @param {PB.ISplitflapCommand=} [properties] Properties to set
-             * @returns {PB.SplitflapCommand} SplitflapCommand instance
-             */
-            SplitflapCommand.create = function create(properties) {
-                return new SplitflapCommand(properties);
-            };
+                /**
+                 * ModuleTelemetry millisSinceLastError.
+                 * @member {number} millisSinceLastError
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @instance
+                 */
+                ModuleTelemetry.prototype.millisSinceLastError = 0;
     
-            /**
-             * Encodes the specified SplitflapCommand message. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
-             * @function encode
-             * @memberof PB.SplitflapCommand
-             * @static
-             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
-             * @param {$protobuf.Writer} [writer] Writer to encode to
-             * @returns {$protobuf.Writer} Writer
-             */
+                /**
+                 * Creates a new ModuleTelemetry instance using the specified properties.
+                 * @function create
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {PB.SplitflapTelemetry.IModuleTelemetry=} [properties] Properties to set
+                 * @returns {PB.SplitflapTelemetry.ModuleTelemetry} ModuleTelemetry instance
+                 */
+                ModuleTelemetry.create = function create(properties) {
+                    return new ModuleTelemetry(properties);
+                };
+    
+                /**
+                 * Encodes the specified ModuleTelemetry message. Does not implicitly {@link PB.SplitflapTelemetry.ModuleTelemetry.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {PB.SplitflapTelemetry.IModuleTelemetry} message ModuleTelemetry message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleTelemetry.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.homeErrorHistogram != null && message.homeErrorHistogram.length) {
+                        writer.uint32(/* id 1, wireType 2 =*/10).fork();
+                        for (var i = 0; i < message.homeErrorHistogram.length; ++i)
+                            writer.uint32(message.homeErrorHistogram[i]);
+                        writer.ldelim();
+                    }
+                    if (message.recoveries != null && Object.hasOwnProperty.call(message, "recoveries"))
+                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.recoveries);
+                    if (message.millisSinceLastError != null && Object.hasOwnProperty.call(message, "millisSinceLastError"))
+                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.millisSinceLastError);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified ModuleTelemetry message, length delimited. Does not implicitly {@link PB.SplitflapTelemetry.ModuleTelemetry.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {PB.SplitflapTelemetry.IModuleTelemetry} message ModuleTelemetry message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleTelemetry.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes a ModuleTelemetry message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.SplitflapTelemetry.ModuleTelemetry} ModuleTelemetry
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleTelemetry.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapTelemetry.ModuleTelemetry();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            if (!(message.homeErrorHistogram && message.homeErrorHistogram.length))
+                                message.homeErrorHistogram = [];
+                            if ((tag & 7) === 2) {
+                                var end2 = reader.uint32() + reader.pos;
+                                while (reader.pos < end2)
+                                    message.homeErrorHistogram.push(reader.uint32());
+                            } else
+                                message.homeErrorHistogram.push(reader.uint32());
+                            break;
+                        case 2:
+                            message.recoveries = reader.uint32();
+                            break;
+                        case 3:
+                            message.millisSinceLastError = reader.uint32();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes a ModuleTelemetry message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.SplitflapTelemetry.ModuleTelemetry} ModuleTelemetry
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleTelemetry.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies a ModuleTelemetry message.
+                 * @function verify
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                ModuleTelemetry.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.homeErrorHistogram != null && message.hasOwnProperty("homeErrorHistogram")) {
+                        if (!Array.isArray(message.homeErrorHistogram))
+                            return "homeErrorHistogram: array expected";
+                        for (var i = 0; i < message.homeErrorHistogram.length; ++i)
+                            if (!$util.isInteger(message.homeErrorHistogram[i]))
+                                return "homeErrorHistogram: integer[] expected";
+                    }
+                    if (message.recoveries != null && message.hasOwnProperty("recoveries"))
+                        if (!$util.isInteger(message.recoveries))
+                            return "recoveries: integer expected";
+                    if (message.millisSinceLastError != null && message.hasOwnProperty("millisSinceLastError"))
+                        if (!$util.isInteger(message.millisSinceLastError))
+                            return "millisSinceLastError: integer expected";
+                    return null;
+                };
+    
+                /**
+                 * Creates a ModuleTelemetry message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.SplitflapTelemetry.ModuleTelemetry} ModuleTelemetry
+                 */
+                ModuleTelemetry.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapTelemetry.ModuleTelemetry)
+                        return object;
+                    var message = new $root.PB.SplitflapTelemetry.ModuleTelemetry();
+                    if (object.homeErrorHistogram) {
+                        if (!Array.isArray(object.homeErrorHistogram))
+                            throw TypeError(".PB.SplitflapTelemetry.ModuleTelemetry.homeErrorHistogram: array expected");
+                        message.homeErrorHistogram = [];
+                        for (var i = 0; i < object.homeErrorHistogram.length; ++i)
+                            message.homeErrorHistogram[i] = object.homeErrorHistogram[i] >>> 0;
+                    }
+                    if (object.recoveries != null)
+                        message.recoveries = object.recoveries >>> 0;
+                    if (object.millisSinceLastError != null)
+                        message.millisSinceLastError = object.millisSinceLastError >>> 0;
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from a ModuleTelemetry message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @static
+                 * @param {PB.SplitflapTelemetry.ModuleTelemetry} message ModuleTelemetry
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                ModuleTelemetry.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.arrays || options.defaults)
+                        object.homeErrorHistogram = [];
+                    if (options.defaults) {
+                        object.recoveries = 0;
+                        object.millisSinceLastError = 0;
+                    }
+                    if (message.homeErrorHistogram && message.homeErrorHistogram.length) {
+                        object.homeErrorHistogram = [];
+                        for (var j = 0; j < message.homeErrorHistogram.length; ++j)
+                            object.homeErrorHistogram[j] = message.homeErrorHistogram[j];
+                    }
+                    if (message.recoveries != null && message.hasOwnProperty("recoveries"))
+                        object.recoveries = message.recoveries;
+                    if (message.millisSinceLastError != null && message.hasOwnProperty("millisSinceLastError"))
+                        object.millisSinceLastError = message.millisSinceLastError;
+                    return object;
+                };
+    
+                /**
+                 * Converts this ModuleTelemetry to JSON.
+                 * @function toJSON
+                 * @memberof PB.SplitflapTelemetry.ModuleTelemetry
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                ModuleTelemetry.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                return ModuleTelemetry;
+            })();
+    
+            return SplitflapTelemetry;
+        })();
+    
+        PB.FromSplitflap = (function() {
+    
+            /**
+             * Properties of a FromSplitflap.
+             * @memberof PB
+             * @interface IFromSplitflap
+             * @property {PB.ISplitflapState|null} [splitflapState] FromSplitflap splitflapState
+             * @property {PB.ILog|null} [log] FromSplitflap log
+             * @property {PB.IAck|null} [ack] FromSplitflap ack
+             * @property {PB.ISupervisorState|null} [supervisorState] FromSplitflap supervisorState
+             * @property {PB.ISplitflapTelemetry|null} [splitflapTelemetry] FromSplitflap splitflapTelemetry
+             */
+    
+            /**
+             * Constructs a new FromSplitflap.
+             * @memberof PB
+             * @classdesc Represents a FromSplitflap.
+             * @implements IFromSplitflap
+             * @constructor
+             * @param {PB.IFromSplitflap=} [properties] Properties to set
+             */
+            function FromSplitflap(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * FromSplitflap splitflapState.
+             * @member {PB.ISplitflapState|null|undefined} splitflapState
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.splitflapState = null;
+    
+            /**
+             * FromSplitflap log.
+             * @member {PB.ILog|null|undefined} log
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.log = null;
+    
+            /**
+             * FromSplitflap ack.
+             * @member {PB.IAck|null|undefined} ack
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.ack = null;
+    
+            /**
+             * FromSplitflap supervisorState.
+             * @member {PB.ISupervisorState|null|undefined} supervisorState
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.supervisorState = null;
+    
+            /**
+             * FromSplitflap splitflapTelemetry.
+             * @member {PB.ISplitflapTelemetry|null|undefined} splitflapTelemetry
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.splitflapTelemetry = null;
+    
+            // OneOf field names bound to virtual getters and setters
+            var $oneOfFields;
+    
+            /**
+             * FromSplitflap payload.
+             * @member {"splitflapState"|"log"|"ack"|"supervisorState"|"splitflapTelemetry"|undefined} payload
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            Object.defineProperty(FromSplitflap.prototype, "payload", {
+                get: $util.oneOfGetter($oneOfFields = ["splitflapState", "log", "ack", "supervisorState", "splitflapTelemetry"]),
+                set: $util.oneOfSetter($oneOfFields)
+            });
+    
+            /**
+             * Creates a new FromSplitflap instance using the specified properties.
+             * @function create
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.IFromSplitflap=} [properties] Properties to set
+             * @returns {PB.FromSplitflap} FromSplitflap instance
+             */
+            FromSplitflap.create = function create(properties) {
+                return new FromSplitflap(properties);
+            };
+    
+            /**
+             * Encodes the specified FromSplitflap message. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * @function encode
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            FromSplitflap.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.splitflapState != null && Object.hasOwnProperty.call(message, "splitflapState"))
+                    $root.PB.SplitflapState.encode(message.splitflapState, writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.log != null && Object.hasOwnProperty.call(message, "log"))
+                    $root.PB.Log.encode(message.log, writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
+                if (message.ack != null && Object.hasOwnProperty.call(message, "ack"))
+                    $root.PB.Ack.encode(message.ack, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
+                if (message.supervisorState != null && Object.hasOwnProperty.call(message, "supervisorState"))
+                    $root.PB.SupervisorState.encode(message.supervisorState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.splitflapTelemetry != null && Object.hasOwnProperty.call(message, "splitflapTelemetry"))
+                    $root.PB.SplitflapTelemetry.encode(message.splitflapTelemetry, writer.uint32(/* id 5, wireType 2 =*/42).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified FromSplitflap message, length delimited. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            FromSplitflap.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a FromSplitflap message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.FromSplitflap} FromSplitflap
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            FromSplitflap.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.FromSplitflap();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.splitflapState = $root.PB.SplitflapState.decode(reader, reader.uint32());
+                        break;
+                    case 2:
+                        message.log = $root.PB.Log.decode(reader, reader.uint32());
+                        break;
+                    case 3:
+                        message.ack = $root.PB.Ack.decode(reader, reader.uint32());
+                        break;
+                    case 4:
+                        message.supervisorState = $root.PB.SupervisorState.decode(reader, reader.uint32());
+                        break;
+                    case 5:
+                        message.splitflapTelemetry = $root.PB.SplitflapTelemetry.decode(reader, reader.uint32());
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a FromSplitflap message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.FromSplitflap} FromSplitflap
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            FromSplitflap.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a FromSplitflap message.
+             * @function verify
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            FromSplitflap.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                var properties = {};
+                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SplitflapState.verify(message.splitflapState);
+                        if (error)
+                            return "splitflapState." + error;
+                    }
+                }
+                if (message.log != null && message.hasOwnProperty("log")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.Log.verify(message.log);
+                        if (error)
+                            return "log." + error;
+                    }
+                }
+                if (message.ack != null && message.hasOwnProperty("ack")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.Ack.verify(message.ack);
+                        if (error)
+                            return "ack." + error;
+                    }
+                }
+                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SupervisorState.verify(message.supervisorState);
+                        if (error)
+                            return "supervisorState." + error;
+                    }
+                }
+                if (message.splitflapTelemetry != null && message.hasOwnProperty("splitflapTelemetry")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SplitflapTelemetry.verify(message.splitflapTelemetry);
+                        if (error)
+                            return "splitflapTelemetry." + error;
+                    }
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a FromSplitflap message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.FromSplitflap} FromSplitflap
+             */
+            FromSplitflap.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.FromSplitflap)
+                    return object;
+                var message = new $root.PB.FromSplitflap();
+                if (object.splitflapState != null) {
+                    if (typeof object.splitflapState !== "object")
+                        throw TypeError(".PB.FromSplitflap.splitflapState: object expected");
+                    message.splitflapState = $root.PB.SplitflapState.fromObject(object.splitflapState);
+                }
+                if (object.log != null) {
+                    if (typeof object.log !== "object")
+                        throw TypeError(".PB.FromSplitflap.log: object expected");
+                    message.log = $root.PB.Log.fromObject(object.log);
+                }
+                if (object.ack != null) {
+                    if (typeof object.ack !== "object")
+                        throw TypeError(".PB.FromSplitflap.ack: object expected");
+                    message.ack = $root.PB.Ack.fromObject(object.ack);
+                }
+                if (object.supervisorState != null) {
+                    if (typeof object.supervisorState !== "object")
+                        throw TypeError(".PB.FromSplitflap.supervisorState: object expected");
+                    message.supervisorState = $root.PB.SupervisorState.fromObject(object.supervisorState);
+                }
+                if (object.splitflapTelemetry != null) {
+                    if (typeof object.splitflapTelemetry !== "object")
+                        throw TypeError(".PB.FromSplitflap.splitflapTelemetry: object expected");
+                    message.splitflapTelemetry = $root.PB.SplitflapTelemetry.fromObject(object.splitflapTelemetry);
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a FromSplitflap message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.FromSplitflap} message FromSplitflap
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            FromSplitflap.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
+                    object.splitflapState = $root.PB.SplitflapState.toObject(message.splitflapState, options);
+                    if (options.oneofs)
+                        object.payload = "splitflapState";
+                }
+                if (message.log != null && message.hasOwnProperty("log")) {
+                    object.log = $root.PB.Log.toObject(message.log, options);
+                    if (options.oneofs)
+                        object.payload = "log";
+                }
+                if (message.ack != null && message.hasOwnProperty("ack")) {
+                    object.ack = $root.PB.Ack.toObject(message.ack, options);
+                    if (options.oneofs)
+                        object.payload = "ack";
+                }
+                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
+                    object.supervisorState = $root.PB.SupervisorState.toObject(message.supervisorState, options);
+                    if (options.oneofs)
+                        object.payload = "supervisorState";
+                }
+                if (message.splitflapTelemetry != null && message.hasOwnProperty("splitflapTelemetry")) {
+                    object.splitflapTelemetry = $root.PB.SplitflapTelemetry.toObject(message.splitflapTelemetry, options);
+                    if (options.oneofs)
+                        object.payload = "splitflapTelemetry";
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this FromSplitflap to JSON.
+             * @function toJSON
+             * @memberof PB.FromSplitflap
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            FromSplitflap.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            return FromSplitflap;
+        })();
+    
+        /**
+         * Acceleration/velocity profile used when moving a module to a new flap. Homing always uses
+         * MOTION_PROFILE_DEFAULT.
+         * @name PB.MotionProfile
+         * @enum {number}
+         * @property {number} MOTION_PROFILE_DEFAULT=0 MOTION_PROFILE_DEFAULT value
+         * @property {number} MOTION_PROFILE_QUIET=1 MOTION_PROFILE_QUIET value
+         * @property {number} MOTION_PROFILE_S_CURVE=2 MOTION_PROFILE_S_CURVE value
+         * @property {number} MOTION_PROFILE_S_CURVE_FAST=3 MOTION_PROFILE_S_CURVE_FAST value
+         */
+        PB.MotionProfile = (function() {
+            var valuesById = {}, values = Object.create(valuesById);
+            values[valuesById[0] = "MOTION_PROFILE_DEFAULT"] = 0;
+            values[valuesById[1] = "MOTION_PROFILE_QUIET"] = 1;
+            values[valuesById[2] = "MOTION_PROFILE_S_CURVE"] = 2;
+            values[valuesById[3] = "MOTION_PROFILE_S_CURVE_FAST"] = 3;
+            return values;
+        })();
+    
+        PB.SplitflapCommand = (function() {
+    
+            /**
+             * Properties of a SplitflapCommand.
+             * @memberof PB
+             * @interface ISplitflapCommand
+             * @property {Array.<PB.SplitflapCommand.IModuleCommand>|null} [modules] SplitflapCommand modules
+             */
+    
+            /**
+             * Constructs a new SplitflapCommand.
+             * @memberof PB
+             * @classdesc Represents a SplitflapCommand.
+             * @implements ISplitflapCommand
+             * @constructor
+             * @param {PB.ISplitflapCommand=} [properties] Properties to set
+             */
+            function SplitflapCommand(properties) {
+                this.modules = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * SplitflapCommand modules.
+             * @member {Array.<PB.SplitflapCommand.IModuleCommand>} modules
+             * @memberof PB.SplitflapCommand
+             * @instance
+             */
+            SplitflapCommand.prototype.modules = $util.emptyArray;
+    
+            /**
+             * Creates a new SplitflapCommand instance using the specified properties.
+             * @function create
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.ISplitflapCommand=} [properties] Properties to set
+             * @returns {PB.SplitflapCommand} SplitflapCommand instance
+             */
+            SplitflapCommand.create = function create(properties) {
+                return new SplitflapCommand(properties);
+            };
+    
+            /**
+             * Encodes the specified SplitflapCommand message. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
             SplitflapCommand.encode = function encode(message, writer) {
                 if (!writer)
                     writer = $Writer.create();
-                if (message.modules != null && message.modules.length)
-                    for (var i = 0; i < message.modules.length; ++i)
-                        $root.PB.SplitflapCommand.ModuleCommand.encode(message.modules[i], writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
+                if (message.modules != null && message.modules.length)
+                    for (var i = 0; i < message.modules.length; ++i)
+                        $root.PB.SplitflapCommand.ModuleCommand.encode(message.modules[i], writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified SplitflapCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapCommand.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a SplitflapCommand message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapCommand.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 2:
+                        if (!(message.modules && message.modules.length))
+                            message.modules = [];
+                        message.modules.push($root.PB.SplitflapCommand.ModuleCommand.decode(reader, reader.uint32()));
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a SplitflapCommand message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapCommand.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a SplitflapCommand message.
+             * @function verify
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            SplitflapCommand.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.modules != null && message.hasOwnProperty("modules")) {
+                    if (!Array.isArray(message.modules))
+                        return "modules: array expected";
+                    for (var i = 0; i < message.modules.length; ++i) {
+                        var error = $root.PB.SplitflapCommand.ModuleCommand.verify(message.modules[i]);
+                        if (error)
+                            return "modules." + error;
+                    }
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a SplitflapCommand message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.SplitflapCommand} SplitflapCommand
+             */
+            SplitflapCommand.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapCommand)
+                    return object;
+                var message = new $root.PB.SplitflapCommand();
+                if (object.modules) {
+                    if (!Array.isArray(object.modules))
+                        throw TypeError(".PB.SplitflapCommand.modules: array expected");
+                    message.modules = [];
+                    for (var i = 0; i < object.modules.length; ++i) {
+                        if (typeof object.modules[i] !== "object")
+                            throw TypeError(".PB.SplitflapCommand.modules: object expected");
+                        message.modules[i] = $root.PB.SplitflapCommand.ModuleCommand.fromObject(object.modules[i]);
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a SplitflapCommand message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.SplitflapCommand} message SplitflapCommand
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            SplitflapCommand.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.modules = [];
+                if (message.modules && message.modules.length) {
+                    object.modules = [];
+                    for (var j = 0; j < message.modules.length; ++j)
+                        object.modules[j] = $root.PB.SplitflapCommand.ModuleCommand.toObject(message.modules[j], options);
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this SplitflapCommand to JSON.
+             * @function toJSON
+             * @memberof PB.SplitflapCommand
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            SplitflapCommand.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            SplitflapCommand.ModuleCommand = (function() {
+    
+                /**
+                 * Properties of a ModuleCommand.
+                 * @memberof PB.SplitflapCommand
+                 * @interface IModuleCommand
+                 * @property {PB.SplitflapCommand.ModuleCommand.Action|null} [action] ModuleCommand action
+                 * @property {number|null} [param] ModuleCommand param
+                 * @property {PB.MotionProfile|null} [motionProfile] ModuleCommand motionProfile
+                 */
+    
+                /**
+                 * Constructs a new ModuleCommand.
+                 * @memberof PB.SplitflapCommand
+                 * @classdesc Represents a ModuleCommand.
+                 * @implements IModuleCommand
+                 * @constructor
+                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
+                 */
+                function ModuleCommand(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * ModuleCommand action.
+                 * @member {PB.SplitflapCommand.ModuleCommand.Action} action
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @instance
+                 */
+                ModuleCommand.prototype.action = 0;
+    
+                /**
+                 * ModuleCommand param.
+                 * @member {number} param
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @instance
+                 */
+                ModuleCommand.prototype.param = 0;
+    
+                /**
+                 * ModuleCommand motionProfile.
+                 * @member {PB.MotionProfile} motionProfile
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @instance
+                 */
+                ModuleCommand.prototype.motionProfile = 0;
+    
+                /**
+                 * Creates a new ModuleCommand instance using the specified properties.
+                 * @function create
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand instance
+                 */
+                ModuleCommand.create = function create(properties) {
+                    return new ModuleCommand(properties);
+                };
+    
+                /**
+                 * Encodes the specified ModuleCommand message. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleCommand.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.action != null && Object.hasOwnProperty.call(message, "action"))
+                        writer.uint32(/* id 1, wireType 0 =*/8).int32(message.action);
+                    if (message.param != null && Object.hasOwnProperty.call(message, "param"))
+                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.param);
+                    if (message.motionProfile != null && Object.hasOwnProperty.call(message, "motionProfile"))
+                        writer.uint32(/* id 3, wireType 0 =*/24).int32(message.motionProfile);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified ModuleCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleCommand.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes a ModuleCommand message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleCommand.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand.ModuleCommand();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            message.action = reader.int32();
+                            break;
+                        case 2:
+                            message.param = reader.uint32();
+                            break;
+                        case 3:
+                            message.motionProfile = reader.int32();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes a ModuleCommand message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleCommand.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies a ModuleCommand message.
+                 * @function verify
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                ModuleCommand.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.action != null && message.hasOwnProperty("action"))
+                        switch (message.action) {
+                        default:
+                            return "action: enum value expected";
+                        case 0:
+                        case 1:
+                        case 2:
+                            break;
+                        }
+                    if (message.param != null && message.hasOwnProperty("param"))
+                        if (!$util.isInteger(message.param))
+                            return "param: integer expected";
+                    if (message.motionProfile != null && message.hasOwnProperty("motionProfile"))
+                        switch (message.motionProfile) {
+                        default:
+                            return "motionProfile: enum value expected";
+                        case 0:
+                        case 1:
+                        case 2:
+                        case 3:
+                            break;
+                        }
+                    return null;
+                };
+    
+                /**
+                 * Creates a ModuleCommand message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
+                 */
+                ModuleCommand.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapCommand.ModuleCommand)
+                        return object;
+                    var message = new $root.PB.SplitflapCommand.ModuleCommand();
+                    switch (object.action) {
+                    case "NO_OP":
+                    case 0:
+                        message.action = 0;
+                        break;
+                    case "GO_TO_FLAP":
+                    case 1:
+                        message.action = 1;
+                        break;
+                    case "RESET_AND_HOME":
+                    case 2:
+                        message.action = 2;
+                        break;
+                    }
+                    if (object.param != null)
+                        message.param = object.param >>> 0;
+                    switch (object.motionProfile) {
+                    case "MOTION_PROFILE_DEFAULT":
+                    case 0:
+                        message.motionProfile = 0;
+                        break;
+                    case "MOTION_PROFILE_QUIET":
+                    case 1:
+                        message.motionProfile = 1;
+                        break;
+                    case "MOTION_PROFILE_S_CURVE":
+                    case 2:
+                        message.motionProfile = 2;
+                        break;
+                    case "MOTION_PROFILE_S_CURVE_FAST":
+                    case 3:
+                        message.motionProfile = 3;
+                        break;
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from a ModuleCommand message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @static
+                 * @param {PB.SplitflapCommand.ModuleCommand} message ModuleCommand
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                ModuleCommand.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.defaults) {
+                        object.action = options.enums === String ? "NO_OP" : 0;
+                        object.param = 0;
+                        object.motionProfile = options.enums === String ? "MOTION_PROFILE_DEFAULT" : 0;
+                    }
+                    if (message.action != null && message.hasOwnProperty("action"))
+                        object.action = options.enums === String ? $root.PB.SplitflapCommand.ModuleCommand.Action[message.action] : message.action;
+                    if (message.param != null && message.hasOwnProperty("param"))
+                        object.param = message.param;
+                    if (message.motionProfile != null && message.hasOwnProperty("motionProfile"))
+                        object.motionProfile = options.enums === String ? $root.PB.MotionProfile[message.motionProfile] : message.motionProfile;
+                    return object;
+                };
+    
+                /**
+                 * Converts this ModuleCommand to JSON.
+                 * @function toJSON
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                ModuleCommand.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                /**
+                 * Action enum.
+                 * @name PB.SplitflapCommand.ModuleCommand.Action
+                 * @enum {number}
+                 * @property {number} NO_OP=0 NO_OP value
+                 * @property {number} GO_TO_FLAP=1 GO_TO_FLAP value
+                 * @property {number} RESET_AND_HOME=2 RESET_AND_HOME value
+                 */
+                ModuleCommand.Action = (function() {
+                    var valuesById = {}, values = Object.create(valuesById);
+                    values[valuesById[0] = "NO_OP"] = 0;
+                    values[valuesById[1] = "GO_TO_FLAP"] = 1;
+                    values[valuesById[2] = "RESET_AND_HOME"] = 2;
+                    return values;
+                })();
+    
+                return ModuleCommand;
+            })();
+    
+            return SplitflapCommand;
+        })();
+    
+        PB.SplitflapConfig = (function() {
+    
+            /**
+             * Properties of a SplitflapConfig.
+             * @memberof PB
+             * @interface ISplitflapConfig
+             * @property {Array.<PB.SplitflapConfig.IModuleConfig>|null} [modules] SplitflapConfig modules
+             */
+    
+            /**
+             * Constructs a new SplitflapConfig.
+             * @memberof PB
+             * @classdesc Represents a SplitflapConfig.
+             * @implements ISplitflapConfig
+             * @constructor
+             * @param {PB.ISplitflapConfig=} [properties] Properties to set
+             */
+            function SplitflapConfig(properties) {
+                this.modules = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * SplitflapConfig modules.
+             * @member {Array.<PB.SplitflapConfig.IModuleConfig>} modules
+             * @memberof PB.SplitflapConfig
+             * @instance
+             */
+            SplitflapConfig.prototype.modules = $util.emptyArray;
+    
+            /**
+             * Creates a new SplitflapConfig instance using the specified properties.
+             * @function create
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.ISplitflapConfig=} [properties] Properties to set
+             * @returns {PB.SplitflapConfig} SplitflapConfig instance
+             */
+            SplitflapConfig.create = function create(properties) {
+                return new SplitflapConfig(properties);
+            };
+    
+            /**
+             * Encodes the specified SplitflapConfig message. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapConfig.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.modules != null && message.modules.length)
+                    for (var i = 0; i < message.modules.length; ++i)
+                        $root.PB.SplitflapConfig.ModuleConfig.encode(message.modules[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified SplitflapConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapConfig.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a SplitflapConfig message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapConfig.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        if (!(message.modules && message.modules.length))
+                            message.modules = [];
+                        message.modules.push($root.PB.SplitflapConfig.ModuleConfig.decode(reader, reader.uint32()));
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a SplitflapConfig message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapConfig.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a SplitflapConfig message.
+             * @function verify
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            SplitflapConfig.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.modules != null && message.hasOwnProperty("modules")) {
+                    if (!Array.isArray(message.modules))
+                        return "modules: array expected";
+                    for (var i = 0; i < message.modules.length; ++i) {
+                        var error = $root.PB.SplitflapConfig.ModuleConfig.verify(message.modules[i]);
+                        if (error)
+                            return "modules." + error;
+                    }
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a SplitflapConfig message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.SplitflapConfig} SplitflapConfig
+             */
+            SplitflapConfig.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapConfig)
+                    return object;
+                var message = new $root.PB.SplitflapConfig();
+                if (object.modules) {
+                    if (!Array.isArray(object.modules))
+                        throw TypeError(".PB.SplitflapConfig.modules: array expected");
+                    message.modules = [];
+                    for (var i = 0; i < object.modules.length; ++i) {
+                        if (typeof object.modules[i] !== "object")
+                            throw TypeError(".PB.SplitflapConfig.modules: object expected");
+                        message.modules[i] = $root.PB.SplitflapConfig.ModuleConfig.fromObject(object.modules[i]);
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a SplitflapConfig message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.SplitflapConfig} message SplitflapConfig
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            SplitflapConfig.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.modules = [];
+                if (message.modules && message.modules.length) {
+                    object.modules = [];
+                    for (var j = 0; j < message.modules.length; ++j)
+                        object.modules[j] = $root.PB.SplitflapConfig.ModuleConfig.toObject(message.modules[j], options);
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this SplitflapConfig to JSON.
+             * @function toJSON
+             * @memberof PB.SplitflapConfig
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            SplitflapConfig.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            SplitflapConfig.ModuleConfig = (function() {
+    
+                /**
+                 * Properties of a ModuleConfig.
+                 * @memberof PB.SplitflapConfig
+                 * @interface IModuleConfig
+                 * @property {number|null} [targetFlapIndex] ModuleConfig targetFlapIndex
+                 * @property {number|null} [movementNonce] Value that triggers a movement upon change. If unused, only changes to target_flap_index
+                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
+                 * flap index.
+                 * 
+                 * NOTE: Must be < 256
+                 * @property {number|null} [resetNonce] Value that triggers a reset (clear error counters, re-home) upon change. If unused,
+                 * module will only re-home upon recoverable errors, and error counters will continue
+                 * to increase until overflow.
+                 * 
+                 * NOTE: Must be < 256
+                 * @property {PB.MotionProfile|null} [motionProfile] Profile for movements of this module. A change only takes effect once the module is
+                 * next at rest.
+                 */
+    
+                /**
+                 * Constructs a new ModuleConfig.
+                 * @memberof PB.SplitflapConfig
+                 * @classdesc Represents a ModuleConfig.
+                 * @implements IModuleConfig
+                 * @constructor
+                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
+                 */
+                function ModuleConfig(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * ModuleConfig targetFlapIndex.
+                 * @member {number} targetFlapIndex
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @instance
+                 */
+                ModuleConfig.prototype.targetFlapIndex = 0;
+    
+                /**
+                 * Value that triggers a movement upon change. If unused, only changes to target_flap_index
+                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
+                 * flap index.
+                 * 
+                 * NOTE: Must be < 256
+                 * @member {number} movementNonce
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @instance
+                 */
+                ModuleConfig.prototype.movementNonce = 0;
+    
+                /**
+                 * Value that triggers a reset (clear error counters, re-home) upon change. If unused,
+                 * module will only re-home upon recoverable errors, and error counters will continue
+                 * to increase until overflow.
+                 * 
+                 * NOTE: Must be < 256
+                 * @member {number} resetNonce
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @instance
+                 */
+                ModuleConfig.prototype.resetNonce = 0;
+    
+                /**
+                 * Profile for movements of this module. A change only takes effect once the module is
+                 * next at rest.
+                 * @member {PB.MotionProfile} motionProfile
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @instance
+                 */
+                ModuleConfig.prototype.motionProfile = 0;
+    
+                /**
+                 * Creates a new ModuleConfig instance using the specified properties.
+                 * @function create
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig instance
+                 */
+                ModuleConfig.create = function create(properties) {
+                    return new ModuleConfig(properties);
+                };
+    
+                /**
+                 * Encodes the specified ModuleConfig message. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleConfig.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.targetFlapIndex != null && Object.hasOwnProperty.call(message, "targetFlapIndex"))
+                        writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.targetFlapIndex);
+                    if (message.movementNonce != null && Object.hasOwnProperty.call(message, "movementNonce"))
+                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.movementNonce);
+                    if (message.resetNonce != null && Object.hasOwnProperty.call(message, "resetNonce"))
+                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.resetNonce);
+                    if (message.motionProfile != null && Object.hasOwnProperty.call(message, "motionProfile"))
+                        writer.uint32(/* id 4, wireType 0 =*/32).int32(message.motionProfile);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified ModuleConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleConfig.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes a ModuleConfig message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleConfig.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig.ModuleConfig();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            message.targetFlapIndex = reader.uint32();
+                            break;
+                        case 2:
+                            message.movementNonce = reader.uint32();
+                            break;
+                        case 3:
+                            message.resetNonce = reader.uint32();
+                            break;
+                        case 4:
+                            message.motionProfile = reader.int32();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes a ModuleConfig message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleConfig.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies a ModuleConfig message.
+                 * @function verify
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                ModuleConfig.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
+                        if (!$util.isInteger(message.targetFlapIndex))
+                            return "targetFlapIndex: integer expected";
+                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
+                        if (!$util.isInteger(message.movementNonce))
+                            return "movementNonce: integer expected";
+                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
+                        if (!$util.isInteger(message.resetNonce))
+                            return "resetNonce: integer expected";
+                    if (message.motionProfile != null && message.hasOwnProperty("motionProfile"))
+                        switch (message.motionProfile) {
+                        default:
+                            return "motionProfile: enum value expected";
+                        case 0:
+                        case 1:
+                        case 2:
+                        case 3:
+                            break;
+                        }
+                    return null;
+                };
+    
+                /**
+                 * Creates a ModuleConfig message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
+                 */
+                ModuleConfig.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapConfig.ModuleConfig)
+                        return object;
+                    var message = new $root.PB.SplitflapConfig.ModuleConfig();
+                    if (object.targetFlapIndex != null)
+                        message.targetFlapIndex = object.targetFlapIndex >>> 0;
+                    if (object.movementNonce != null)
+                        message.movementNonce = object.movementNonce >>> 0;
+                    if (object.resetNonce != null)
+                        message.resetNonce = object.resetNonce >>> 0;
+                    switch (object.motionProfile) {
+                    case "MOTION_PROFILE_DEFAULT":
+                    case 0:
+                        message.motionProfile = 0;
+                        break;
+                    case "MOTION_PROFILE_QUIET":
+                    case 1:
+                        message.motionProfile = 1;
+                        break;
+                    case "MOTION_PROFILE_S_CURVE":
+                    case 2:
+                        message.motionProfile = 2;
+                        break;
+                    case "MOTION_PROFILE_S_CURVE_FAST":
+                    case 3:
+                        message.motionProfile = 3;
+                        break;
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from a ModuleConfig message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @static
+                 * @param {PB.SplitflapConfig.ModuleConfig} message ModuleConfig
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                ModuleConfig.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.defaults) {
+                        object.targetFlapIndex = 0;
+                        object.movementNonce = 0;
+                        object.resetNonce = 0;
+                        object.motionProfile = options.enums === String ? "MOTION_PROFILE_DEFAULT" : 0;
+                    }
+                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
+                        object.targetFlapIndex = message.targetFlapIndex;
+                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
+                        object.movementNonce = message.movementNonce;
+                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
+                        object.resetNonce = message.resetNonce;
+                    if (message.motionProfile != null && message.hasOwnProperty("motionProfile"))
+                        object.motionProfile = options.enums === String ? $root.PB.MotionProfile[message.motionProfile] : message.motionProfile;
+                    return object;
+                };
+    
+                /**
+                 * Converts this ModuleConfig to JSON.
+                 * @function toJSON
+                 * @memberof PB.SplitflapConfig.ModuleConfig
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                ModuleConfig.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                return ModuleConfig;
+            })();
+    
+            return SplitflapConfig;
+        })();
+    
+        PB.SplitflapSequence = (function() {
+    
+            /**
+             * Properties of a SplitflapSequence.
+             * @memberof PB
+             * @interface ISplitflapSequence
+             * @property {Array.<PB.SplitflapSequence.IModuleSequence>|null} [modules] SplitflapSequence modules
+             * @property {number|null} [dwellMillis] SplitflapSequence dwellMillis
+             */
+    
+            /**
+             * Constructs a new SplitflapSequence.
+             * @memberof PB
+             * @classdesc Queues up a sequence of flaps for each module to show in turn. Each module moves on to its
+             * next flap as soon as it has shown the previous one for dwell_millis, independently of the
+             * other modules.
+             * @implements ISplitflapSequence
+             * @constructor
+             * @param {PB.ISplitflapSequence=} [properties] Properties to set
+             */
+            function SplitflapSequence(properties) {
+                this.modules = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * SplitflapSequence modules.
+             * @member {Array.<PB.SplitflapSequence.IModuleSequence>} modules
+             * @memberof PB.SplitflapSequence
+             * @instance
+             */
+            SplitflapSequence.prototype.modules = $util.emptyArray;
+    
+            /**
+             * SplitflapSequence dwellMillis.
+             * @member {number} dwellMillis
+             * @memberof PB.SplitflapSequence
+             * @instance
+             */
+            SplitflapSequence.prototype.dwellMillis = 0;
+    
+            /**
+             * Creates a new SplitflapSequence instance using the specified properties.
+             * @function create
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.ISplitflapSequence=} [properties] Properties to set
+             * @returns {PB.SplitflapSequence} SplitflapSequence instance
+             */
+            SplitflapSequence.create = function create(properties) {
+                return new SplitflapSequence(properties);
+            };
+    
+            /**
+             * Encodes the specified SplitflapSequence message. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.ISplitflapSequence} message SplitflapSequence message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapSequence.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.modules != null && message.modules.length)
+                    for (var i = 0; i < message.modules.length; ++i)
+                        $root.PB.SplitflapSequence.ModuleSequence.encode(message.modules[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.dwellMillis != null && Object.hasOwnProperty.call(message, "dwellMillis"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.dwellMillis);
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified SplitflapSequence message, length delimited. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.ISplitflapSequence} message SplitflapSequence message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapSequence.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a SplitflapSequence message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.SplitflapSequence} SplitflapSequence
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapSequence.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapSequence();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        if (!(message.modules && message.modules.length))
+                            message.modules = [];
+                        message.modules.push($root.PB.SplitflapSequence.ModuleSequence.decode(reader, reader.uint32()));
+                        break;
+                    case 2:
+                        message.dwellMillis = reader.uint32();
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a SplitflapSequence message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.SplitflapSequence} SplitflapSequence
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapSequence.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a SplitflapSequence message.
+             * @function verify
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            SplitflapSequence.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.modules != null && message.hasOwnProperty("modules")) {
+                    if (!Array.isArray(message.modules))
+                        return "modules: array expected";
+                    for (var i = 0; i < message.modules.length; ++i) {
+                        var error = $root.PB.SplitflapSequence.ModuleSequence.verify(message.modules[i]);
+                        if (error)
+                            return "modules." + error;
+                    }
+                }
+                if (message.dwellMillis != null && message.hasOwnProperty("dwellMillis"))
+                    if (!$util.isInteger(message.dwellMillis))
+                        return "dwellMillis: integer expected";
+                return null;
+            };
+    
+            /**
+             * Creates a SplitflapSequence message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.SplitflapSequence} SplitflapSequence
+             */
+            SplitflapSequence.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapSequence)
+                    return object;
+                var message = new $root.PB.SplitflapSequence();
+                if (object.modules) {
+                    if (!Array.isArray(object.modules))
+                        throw TypeError(".PB.SplitflapSequence.modules: array expected");
+                    message.modules = [];
+                    for (var i = 0; i < object.modules.length; ++i) {
+                        if (typeof object.modules[i] !== "object")
+                            throw TypeError(".PB.SplitflapSequence.modules: object expected");
+                        message.modules[i] = $root.PB.SplitflapSequence.ModuleSequence.fromObject(object.modules[i]);
+                    }
+                }
+                if (object.dwellMillis != null)
+                    message.dwellMillis = object.dwellMillis >>> 0;
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a SplitflapSequence message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.SplitflapSequence} message SplitflapSequence
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            SplitflapSequence.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.modules = [];
+                if (options.defaults)
+                    object.dwellMillis = 0;
+                if (message.modules && message.modules.length) {
+                    object.modules = [];
+                    for (var j = 0; j < message.modules.length; ++j)
+                        object.modules[j] = $root.PB.SplitflapSequence.ModuleSequence.toObject(message.modules[j], options);
+                }
+                if (message.dwellMillis != null && message.hasOwnProperty("dwellMillis"))
+                    object.dwellMillis = message.dwellMillis;
+                return object;
+            };
+    
+            /**
+             * Converts this SplitflapSequence to JSON.
+             * @function toJSON
+             * @memberof PB.SplitflapSequence
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            SplitflapSequence.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            SplitflapSequence.ModuleSequence = (function() {
+    
+                /**
+                 * Properties of a ModuleSequence.
+                 * @memberof PB.SplitflapSequence
+                 * @interface IModuleSequence
+                 * @property {Uint8Array|null} [flapIndices] Flap indices to show, in order. These are added after any flaps still pending from a
+                 * previous sequence; any other command for the module clears them.
+                 */
+    
+                /**
+                 * Constructs a new ModuleSequence.
+                 * @memberof PB.SplitflapSequence
+                 * @classdesc Represents a ModuleSequence.
+                 * @implements IModuleSequence
+                 * @constructor
+                 * @param {PB.SplitflapSequence.IModuleSequence=} [properties] Properties to set
+                 */
+                function ModuleSequence(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * Flap indices to show, in order. These are added after any flaps still pending from a
+                 * previous sequence; any other command for the module clears them.
+                 * @member {Uint8Array} flapIndices
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @instance
+                 */
+                ModuleSequence.prototype.flapIndices = $util.newBuffer([]);
+    
+                /**
+                 * Creates a new ModuleSequence instance using the specified properties.
+                 * @function create
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {PB.SplitflapSequence.IModuleSequence=} [properties] Properties to set
+                 * @returns {PB.SplitflapSequence.ModuleSequence} ModuleSequence instance
+                 */
+                ModuleSequence.create = function create(properties) {
+                    return new ModuleSequence(properties);
+                };
+    
+                /**
+                 * Encodes the specified ModuleSequence message. Does not implicitly {@link PB.SplitflapSequence.ModuleSequence.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {PB.SplitflapSequence.IModuleSequence} message ModuleSequence message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleSequence.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.flapIndices != null && Object.hasOwnProperty.call(message, "flapIndices"))
+                        writer.uint32(/* id 1, wireType 2 =*/10).bytes(message.flapIndices);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified ModuleSequence message, length delimited. Does not implicitly {@link PB.SplitflapSequence.ModuleSequence.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {PB.SplitflapSequence.IModuleSequence} message ModuleSequence message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                ModuleSequence.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes a ModuleSequence message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.SplitflapSequence.ModuleSequence} ModuleSequence
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleSequence.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapSequence.ModuleSequence();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            message.flapIndices = reader.bytes();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes a ModuleSequence message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.SplitflapSequence.ModuleSequence} ModuleSequence
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                ModuleSequence.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies a ModuleSequence message.
+                 * @function verify
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                ModuleSequence.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.flapIndices != null && message.hasOwnProperty("flapIndices"))
+                        if (!(message.flapIndices && typeof message.flapIndices.length === "number" || $util.isString(message.flapIndices)))
+                            return "flapIndices: buffer expected";
+                    return null;
+                };
+    
+                /**
+                 * Creates a ModuleSequence message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.SplitflapSequence.ModuleSequence} ModuleSequence
+                 */
+                ModuleSequence.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapSequence.ModuleSequence)
+                        return object;
+                    var message = new $root.PB.SplitflapSequence.ModuleSequence();
+                    if (object.flapIndices != null)
+                        if (typeof object.flapIndices === "string")
+                            $util.base64.decode(object.flapIndices, message.flapIndices = $util.newBuffer($util.base64.length(object.flapIndices)), 0);
+                        else if (object.flapIndices.length)
+                            message.flapIndices = object.flapIndices;
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from a ModuleSequence message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @static
+                 * @param {PB.SplitflapSequence.ModuleSequence} message ModuleSequence
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                ModuleSequence.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.defaults)
+                        if (options.bytes === String)
+                            object.flapIndices = "";
+                        else {
+                            object.flapIndices = [];
+                            if (options.bytes !== Array)
+                                object.flapIndices = $util.newBuffer(object.flapIndices);
+                        }
+                    if (message.flapIndices != null && message.hasOwnProperty("flapIndices"))
+                        object.flapIndices = options.bytes === String ? $util.base64.encode(message.flapIndices, 0, message.flapIndices.length) : options.bytes === Array ? Array.prototype.slice.call(message.flapIndices) : message.flapIndices;
+                    return object;
+                };
+    
+                /**
+                 * Converts this ModuleSequence to JSON.
+                 * @function toJSON
+                 * @memberof PB.SplitflapSequence.ModuleSequence
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                ModuleSequence.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                return ModuleSequence;
+            })();
+    
+            return SplitflapSequence;
+        })();
+    
+        PB.SplitflapCharacterSets = (function() {
+    
+            /**
+             * Properties of a SplitflapCharacterSets.
+             * @memberof PB
+             * @interface ISplitflapCharacterSets
+             * @property {Array.<PB.SplitflapCharacterSets.ICharacterSet>|null} [characterSets] SplitflapCharacterSets characterSets
+             * @property {Uint8Array|null} [moduleCharacterSets] SplitflapCharacterSets moduleCharacterSets
+             */
+    
+            /**
+             * Constructs a new SplitflapCharacterSets.
+             * @memberof PB
+             * @classdesc Replaces the character sets used to find the flap showing a given character (e.g. for text sent
+             * via MQTT or the legacy serial protocol), and assigns one to each module, so that modules with
+             * different flaps (letters, digits, colors) can share a display. Saved to flash, so it persists
+             * across restarts.
+             * @implements ISplitflapCharacterSets
+             * @constructor
+             * @param {PB.ISplitflapCharacterSets=} [properties] Properties to set
+             */
+            function SplitflapCharacterSets(properties) {
+                this.characterSets = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * SplitflapCharacterSets characterSets.
+             * @member {Array.<PB.SplitflapCharacterSets.ICharacterSet>} characterSets
+             * @memberof PB.SplitflapCharacterSets
+             * @instance
+             */
+            SplitflapCharacterSets.prototype.characterSets = $util.emptyArray;
+    
+            /**
+             * SplitflapCharacterSets moduleCharacterSets.
+             * @member {Uint8Array} moduleCharacterSets
+             * @memberof PB.SplitflapCharacterSets
+             * @instance
+             */
+            SplitflapCharacterSets.prototype.moduleCharacterSets = $util.newBuffer([]);
+    
+            /**
+             * Creates a new SplitflapCharacterSets instance using the specified properties.
+             * @function create
+             * @memberof PB.SplitflapCharacterSets
+             * @static
+             * @param {PB.ISplitflapCharacterSets=} [properties] Properties to set
+             * @returns {PB.SplitflapCharacterSets} SplitflapCharacterSets instance
+             */
+            SplitflapCharacterSets.create = function create(properties) {
+                return new SplitflapCharacterSets(properties);
+            };
+    
+            /**
+             * Encodes the specified SplitflapCharacterSets message. Does not implicitly {@link PB.SplitflapCharacterSets.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SplitflapCharacterSets
+             * @static
+             * @param {PB.ISplitflapCharacterSets} message SplitflapCharacterSets message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapCharacterSets.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.characterSets != null && message.characterSets.length)
+                    for (var i = 0; i < message.characterSets.length; ++i)
+                        $root.PB.SplitflapCharacterSets.CharacterSet.encode(message.characterSets[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.moduleCharacterSets != null && Object.hasOwnProperty.call(message, "moduleCharacterSets"))
+                    writer.uint32(/* id 2, wireType 2 =*/18).bytes(message.moduleCharacterSets);
                 return writer;
             };
     
             /**
-             * Encodes the specified SplitflapCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
+             * Encodes the specified SplitflapCharacterSets message, length delimited. Does not implicitly {@link PB.SplitflapCharacterSets.verify|verify} messages.
              * @function encodeDelimited
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.SplitflapCharacterSets
              * @static
-             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
+             * @param {PB.ISplitflapCharacterSets} message SplitflapCharacterSets message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SplitflapCommand.encodeDelimited = function encodeDelimited(message, writer) {
+            SplitflapCharacterSets.encodeDelimited = function encodeDelimited(message, writer) {
                 return this.encode(message, writer).ldelim();
             };
     
             /**
-             * Decodes a SplitflapCommand message from the specified reader or buffer.
+             * Decodes a SplitflapCharacterSets message from the specified reader or buffer.
              * @function decode
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.SplitflapCharacterSets
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
              * @param {number} [length] Message length if known beforehand
-             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @returns {PB.SplitflapCharacterSets} SplitflapCharacterSets
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapCommand.decode = function decode(reader, length) {
+            SplitflapCharacterSets.decode = function decode(reader, length) {
                 if (!(reader instanceof $Reader))
                     reader = $Reader.create(reader);
-                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand();
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCharacterSets();
                 while (reader.pos < end) {
                     var tag = reader.uint32();
                     switch (tag >>> 3) {
+                    case 1:
+                        if (!(message.characterSets && message.characterSets.length))
+                            message.characterSets = [];
+                        message.characterSets.push($root.PB.SplitflapCharacterSets.CharacterSet.decode(reader, reader.uint32()));
+                        break;
                     case 2:
-                        if (!(message.modules && message.modules.length))
-                            message.modules = [];
-                        message.modules.push($root.PB.SplitflapCommand.ModuleCommand.decode(reader, reader.uint32()));
+                        message.moduleCharacterSets = reader.bytes();
                         break;
                     default:
                         reader.skipType(tag & 7);
@@ -2236,122 +4278,139 @@
             };
     
             /**
-             * Decodes a SplitflapCommand message from the specified reader or buffer, length delimited.
+             * Decodes a SplitflapCharacterSets message from the specified reader or buffer, length delimited.
              * @function decodeDelimited
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.SplitflapCharacterSets
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @returns {PB.SplitflapCharacterSets} SplitflapCharacterSets
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapCommand.decodeDelimited = function decodeDelimited(reader) {
+            SplitflapCharacterSets.decodeDelimited = function decodeDelimited(reader) {
                 if (!(reader instanceof $Reader))
                     reader = new $Reader(reader);
                 return this.decode(reader, reader.uint32());
             };
     
             /**
-             * Verifies a SplitflapCommand message.
+             * Verifies a SplitflapCharacterSets message.
              * @function verify
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.SplitflapCharacterSets
              * @static
              * @param {Object.<string,*>} message Plain object to verify
              * @returns {string|null} `null` if valid, otherwise the reason why it is not
              */
-            SplitflapCommand.verify = function verify(message) {
+            SplitflapCharacterSets.verify = function verify(message) {
                 if (typeof message !== "object" || message === null)
                     return "object expected";
-                if (message.modules != null && message.hasOwnProperty("modules")) {
-                    if (!Array.isArray(message.modules))
-                        return "modules: array expected";
-                    for (var i = 0; i < message.modules.length; ++i) {
-                        var error = $root.PB.SplitflapCommand.ModuleCommand.verify(message.modules[i]);
+                if (message.characterSets != null && message.hasOwnProperty("characterSets")) {
+                    if (!Array.isArray(message.characterSets))
+                        return "characterSets: array expected";
+                    for (var i = 0; i < message.characterSets.length; ++i) {
+                        var error = $root.PB.SplitflapCharacterSets.CharacterSet.verify(message.characterSets[i]);
                         if (error)
-                            return "modules." + error;
+                            return "characterSets." + error;
                     }
                 }
+                if (message.moduleCharacterSets != null && message.hasOwnProperty("moduleCharacterSets"))
+                    if (!(message.moduleCharacterSets && typeof message.moduleCharacterSets.length === "number" || $util.isString(message.moduleCharacterSets)))
+                        return "moduleCharacterSets: buffer expected";
                 return null;
             };
     
             /**
-             * Creates a SplitflapCommand message from a plain object. Also converts values to their respective internal types.
+             * Creates a SplitflapCharacterSets message from a plain object. Also converts values to their respective internal types.
              * @function fromObject
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.SplitflapCharacterSets
              * @static
              * @param {Object.<string,*>} object Plain object
-             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @returns {PB.SplitflapCharacterSets} SplitflapCharacterSets
              */
-            SplitflapCommand.fromObject = function fromObject(object) {
-                if (object instanceof $root.PB.SplitflapCommand)
+            SplitflapCharacterSets.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapCharacterSets)
                     return object;
-                var message = new $root.PB.SplitflapCommand();
-                if (object.modules) {
-                    if (!Array.isArray(object.modules))
-                        throw TypeError(".PB.SplitflapCommand.modules: array expected");
-                    message.modules = [];
-                    for (var i = 0; i < object.modules.length; ++i) {
-                        if (typeof object.modules[i] !== "object")
-                            throw TypeError(".PB.SplitflapCommand.modules: object expected");
-                        message.modules[i] = $root.PB.SplitflapCommand.ModuleCommand.fromObject(object.modules[i]);
+                var message = new $root.PB.SplitflapCharacterSets();
+                if (object.characterSets) {
+                    if (!Array.isArray(object.characterSets))
+                        throw TypeError(".PB.SplitflapCharacterSets.characterSets: array expected");
+                    message.characterSets = [];
+                    for (var i = 0; i < object.characterSets.length; ++i) {
+                        if (typeof object.characterSets[i] !== "object")
+                            throw TypeError(".PB.SplitflapCharacterSets.characterSets: object expected");
+                        message.characterSets[i] = $root.PB.SplitflapCharacterSets.CharacterSet.fromObject(object.characterSets[i]);
                     }
                 }
+                if (object.moduleCharacterSets != null)
+                    if (typeof object.moduleCharacterSets === "string")
+                        $util.base64.decode(object.moduleCharacterSets, message.moduleCharacterSets = $util.newBuffer($util.base64.length(object.moduleCharacterSets)), 0);
+                    else if (object.moduleCharacterSets.length)
+                        message.moduleCharacterSets = object.moduleCharacterSets;
                 return message;
             };
     
             /**
-             * Creates a plain object from a SplitflapCommand message. Also converts values to other types if specified.
+             * Creates a plain object from a SplitflapCharacterSets message. Also converts values to other types if specified.
              * @function toObject
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.SplitflapCharacterSets
              * @static
-             * @param {PB.SplitflapCommand} message SplitflapCommand
+             * @param {PB.SplitflapCharacterSets} message SplitflapCharacterSets
              * @param {$protobuf.IConversionOptions} [options] Conversion options
              * @returns {Object.<string,*>} Plain object
              */
-            SplitflapCommand.toObject = function toObject(message, options) {
+            SplitflapCharacterSets.toObject = function toObject(message, options) {
                 if (!options)
                     options = {};
                 var object = {};
                 if (options.arrays || options.defaults)
-                    object.modules = [];
-                if (message.modules && message.modules.length) {
-                    object.modules = [];
-                    for (var j = 0; j < message.modules.length; ++j)
-                        object.modules[j] = $root.PB.SplitflapCommand.ModuleCommand.toObject(message.modules[j], options);
+                    object.characterSets = [];
+                if (options.defaults)
+                    if (options.bytes === String)
+                        object.moduleCharacterSets = "";
+                    else {
+                        object.moduleCharacterSets = [];
+                        if (options.bytes !== Array)
+                            object.moduleCharacterSets = $util.newBuffer(object.moduleCharacterSets);
+                    }
+                if (message.characterSets && message.characterSets.length) {
+                    object.characterSets = [];
+                    for (var j = 0; j < message.characterSets.length; ++j)
+                        object.characterSets[j] = $root.PB.SplitflapCharacterSets.CharacterSet.toObject(message.characterSets[j], options);
                 }
+                if (message.moduleCharacterSets != null && message.hasOwnProperty("moduleCharacterSets"))
+                    object.moduleCharacterSets = options.bytes === String ? $util.base64.encode(message.moduleCharacterSets, 0, message.moduleCharacterSets.length) : options.bytes === Array ? Array.prototype.slice.call(message.moduleCharacterSets) : message.moduleCharacterSets;
                 return object;
             };
     
             /**
-             * Converts this SplitflapCommand to JSON.
+             * Converts this SplitflapCharacterSets to JSON.
              * @function toJSON
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.SplitflapCharacterSets
              * @instance
              * @returns {Object.<string,*>} JSON object
              */
-            SplitflapCommand.prototype.toJSON = function toJSON() {
+            SplitflapCharacterSets.prototype.toJSON = function toJSON() {
                 return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
             };
     
-            SplitflapCommand.ModuleCommand = (function() {
+            SplitflapCharacterSets.CharacterSet = (function() {
     
                 /**
-                 * Properties of a ModuleCommand.
-                 * @memberof PB.SplitflapCommand
-                 * @interface IModuleCommand
-                 * @property {PB.SplitflapCommand.ModuleCommand.Action|null} [action] ModuleCommand action
-                 * @property {number|null} [param] ModuleCommand param
+                 * Properties of a CharacterSet.
+                 * @memberof PB.SplitflapCharacterSets
+                 * @interface ICharacterSet
+                 * @property {Uint8Array|null} [flaps] CharacterSet flaps
                  */
     
                 /**
-                 * Constructs a new ModuleCommand.
-                 * @memberof PB.SplitflapCommand
-                 * @classdesc Represents a ModuleCommand.
-                 * @implements IModuleCommand
+                 * Constructs a new CharacterSet.
+                 * @memberof PB.SplitflapCharacterSets
+                 * @classdesc Represents a CharacterSet.
+                 * @implements ICharacterSet
                  * @constructor
-                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
+                 * @param {PB.SplitflapCharacterSets.ICharacterSet=} [properties] Properties to set
                  */
-                function ModuleCommand(properties) {
+                function CharacterSet(properties) {
                     if (properties)
                         for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                             if (properties[keys[i]] != null)
@@ -2359,88 +4418,75 @@
                 }
     
                 /**
-                 * ModuleCommand action.
-                 * @member {PB.SplitflapCommand.ModuleCommand.Action} action
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @instance
-                 */
-                ModuleCommand.prototype.action = 0;
-    
-                /**
-                 * ModuleCommand param.
-                 * @member {number} param
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * CharacterSet flaps.
+                 * @member {Uint8Array} flaps
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @instance
                  */
-                ModuleCommand.prototype.param = 0;
+                CharacterSet.prototype.flaps = $util.newBuffer([]);
     
                 /**
-                 * Creates a new ModuleCommand instance using the specified properties.
+                 * Creates a new CharacterSet instance using the specified properties.
                  * @function create
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
-                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand instance
+                 * @param {PB.SplitflapCharacterSets.ICharacterSet=} [properties] Properties to set
+                 * @returns {PB.SplitflapCharacterSets.CharacterSet} CharacterSet instance
                  */
-                ModuleCommand.create = function create(properties) {
-                    return new ModuleCommand(properties);
+                CharacterSet.create = function create(properties) {
+                    return new CharacterSet(properties);
                 };
     
                 /**
-                 * Encodes the specified ModuleCommand message. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
+                 * Encodes the specified CharacterSet message. Does not implicitly {@link PB.SplitflapCharacterSets.CharacterSet.verify|verify} messages.
                  * @function encode
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
-                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
+                 * @param {PB.SplitflapCharacterSets.ICharacterSet} message CharacterSet message or plain object to encode
                  * @param {$protobuf.Writer} [writer] Writer to encode to
                  * @returns {$protobuf.Writer} Writer
                  */
-                ModuleCommand.encode = function encode(message, writer) {
+                CharacterSet.encode = function encode(message, writer) {
                     if (!writer)
                         writer = $Writer.create();
-                    if (message.action != null && Object.hasOwnProperty.call(message, "action"))
-                        writer.uint32(/* id 1, wireType 0 =*/8).int32(message.action);
-                    if (message.param != null && Object.hasOwnProperty.call(message, "param"))
-                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.param);
+                    if (message.flaps != null && Object.hasOwnProperty.call(message, "flaps"))
+                        writer.uint32(/* id 1, wireType 2 =*/10).bytes(message.flaps);
                     return writer;
                 };
     
                 /**
-                 * Encodes the specified ModuleCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
+                 * Encodes the specified CharacterSet message, length delimited. Does not implicitly {@link PB.SplitflapCharacterSets.CharacterSet.verify|verify} messages.
                  * @function encodeDelimited
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
-                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
+                 * @param {PB.SplitflapCharacterSets.ICharacterSet} message CharacterSet message or plain object to encode
                  * @param {$protobuf.Writer} [writer] Writer to encode to
                  * @returns {$protobuf.Writer} Writer
                  */
-                ModuleCommand.encodeDelimited = function encodeDelimited(message, writer) {
+                CharacterSet.encodeDelimited = function encodeDelimited(message, writer) {
                     return this.encode(message, writer).ldelim();
                 };
     
                 /**
-                 * Decodes a ModuleCommand message from the specified reader or buffer.
+                 * Decodes a CharacterSet message from the specified reader or buffer.
                  * @function decode
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
                  * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
                  * @param {number} [length] Message length if known beforehand
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
+                 * @returns {PB.SplitflapCharacterSets.CharacterSet} CharacterSet
                  * @throws {Error} If the payload is not a reader or valid buffer
                  * @throws {$protobuf.util.ProtocolError} If required fields are missing
                  */
-                ModuleCommand.decode = function decode(reader, length) {
+                CharacterSet.decode = function decode(reader, length) {
                     if (!(reader instanceof $Reader))
                         reader = $Reader.create(reader);
-                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand.ModuleCommand();
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCharacterSets.CharacterSet();
                     while (reader.pos < end) {
                         var tag = reader.uint32();
                         switch (tag >>> 3) {
                         case 1:
-                            message.action = reader.int32();
-                            break;
-                        case 2:
-                            message.param = reader.uint32();
+                            message.flaps = reader.bytes();
                             break;
                         default:
                             reader.skipType(tag & 7);
@@ -2451,154 +4497,118 @@
                 };
     
                 /**
-                 * Decodes a ModuleCommand message from the specified reader or buffer, length delimited.
+                 * Decodes a CharacterSet message from the specified reader or buffer, length delimited.
                  * @function decodeDelimited
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
                  * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
+                 * @returns {PB.SplitflapCharacterSets.CharacterSet} CharacterSet
                  * @throws {Error} If the payload is not a reader or valid buffer
                  * @throws {$protobuf.util.ProtocolError} If required fields are missing
                  */
-                ModuleCommand.decodeDelimited = function decodeDelimited(reader) {
+                CharacterSet.decodeDelimited = function decodeDelimited(reader) {
                     if (!(reader instanceof $Reader))
                         reader = new $Reader(reader);
                     return this.decode(reader, reader.uint32());
                 };
     
                 /**
-                 * Verifies a ModuleCommand message.
+                 * Verifies a CharacterSet message.
                  * @function verify
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
                  * @param {Object.<string,*>} message Plain object to verify
                  * @returns {string|null} `null` if valid, otherwise the reason why it is not
                  */
-                ModuleCommand.verify = function verify(message) {
+                CharacterSet.verify = function verify(message) {
                     if (typeof message !== "object" || message === null)
                         return "object expected";
-                    if (message.action != null && message.hasOwnProperty("action"))
-                        switch (message.action) {
-                        default:
-                            return "action: enum value expected";
-                        case 0:
-                        case 1:
-                        case 2:
-                            break;
-                        }
-                    if (message.param != null && message.hasOwnProperty("param"))
-                        if (!$util.isInteger(message.param))
-                            return "param: integer expected";
+                    if (message.flaps != null && message.hasOwnProperty("flaps"))
+                        if (!(message.flaps && typeof message.flaps.length === "number" || $util.isString(message.flaps)))
+                            return "flaps: buffer expected";
                     return null;
                 };
     
                 /**
-                 * Creates a ModuleCommand message from a plain object. Also converts values to their respective internal types.
+                 * Creates a CharacterSet message from a plain object. Also converts values to their respective internal types.
                  * @function fromObject
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
                  * @param {Object.<string,*>} object Plain object
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
+                 * @returns {PB.SplitflapCharacterSets.CharacterSet} CharacterSet
                  */
-                ModuleCommand.fromObject = function fromObject(object) {
-                    if (object instanceof $root.PB.SplitflapCommand.ModuleCommand)
+                CharacterSet.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapCharacterSets.CharacterSet)
                         return object;
-                    var message = new $root.PB.SplitflapCommand.ModuleCommand();
-                    switch (object.action) {
-                    case "NO_OP":
-                    case 0:
-                        message.action = 0;
-                        break;
-                    case "GO_TO_FLAP":
-                    case 1:
-                        message.action = 1;
-                        break;
-                    case "RESET_AND_HOME":
-                    case 2:
-                        message.action = 2;
-                        break;
-                    }
-                    if (object.param != null)
-                        message.param = object.param >>> 0;
+                    var message = new $root.PB.SplitflapCharacterSets.CharacterSet();
+                    if (object.flaps != null)
+                        if (typeof object.flaps === "string")
+                            $util.base64.decode(object.flaps, message.flaps = $util.newBuffer($util.base64.length(object.flaps)), 0);
+                        else if (object.flaps.length)
+                            message.flaps = object.flaps;
                     return message;
                 };
     
                 /**
-                 * Creates a plain object from a ModuleCommand message. Also converts values to other types if specified.
+                 * Creates a plain object from a CharacterSet message. Also converts values to other types if specified.
                  * @function toObject
-                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
                  * @static
-                 * @param {PB.SplitflapCommand.ModuleCommand} message ModuleCommand
+                 * @param {PB.SplitflapCharacterSets.CharacterSet} message CharacterSet
                  * @param {$protobuf.IConversionOptions} [options] Conversion options
                  * @returns {Object.<string,*>} Plain object
                  */
-                ModuleCommand.toObject = function toObject(message, options) {
+                CharacterSet.toObject = function toObject(message, options) {
                     if (!options)
                         options = {};
                     var object = {};
-                    if (options.defaults) {
-                        object.action = options.enums === String ? "NO_OP" : 0;
-                        object.param = 0;
-                    }
-                    if (message.action != null && message.hasOwnProperty("action"))
-                        object.action = options.enums === String ? $root.PB.SplitflapCommand.ModuleCommand.Action[message.action] : message.action;
-                    if (message.param != null && message.hasOwnProperty("param"))
-                        object.param = message.param;
+                    if (options.defaults)
+                        if (options.bytes === String)
+                            object.flaps = "";
+                        else {
+                            object.flaps = [];
+                            if (options.bytes !== Array)
+                                object.flaps = $util.newBuffer(object.flaps);
+                        }
+                    if (message.flaps != null && message.hasOwnProperty("flaps"))
+                        object.flaps = options.bytes === String ? $util.base64.encode(message.flaps, 0, message.flaps.length) : options.bytes === Array ? Array.prototype.slice.call(message.flaps) : message.flaps;
                     return object;
                 };
     
                 /**
-                 * Converts this ModuleCommand to JSON.
+                 * Converts this CharacterSet to JSON.
                  * @function toJSON
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @instance
-                 * @returns {Object.<string,*>} JSON object
-                 */
-                ModuleCommand.prototype.toJSON = function toJSON() {
-                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
-                };
-    
-                /**
-                 * Action enum.
-                 * @name PB.SplitflapCommand.ModuleCommand.Action
-                 * @enum {number}
-                 * @property {number} NO_OP=0 NO_OP value
-                 * @property {number} GO_TO_FLAP=1 GO_TO_FLAP value
-                 * @property {number} RESET_AND_HOME=2 RESET_AND_HOME value
+                 * @memberof PB.SplitflapCharacterSets.CharacterSet
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
                  */
-                ModuleCommand.Action = (function() {
-                    var valuesById = {}, values = Object.create(valuesById);
-                    values[valuesById[0] = "NO_OP"] = 0;
-                    values[valuesById[1] = "GO_TO_FLAP"] = 1;
-                    values[valuesById[2] = "RESET_AND_HOME"] = 2;
-                    return values;
-                })();
+                CharacterSet.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
     
-                return ModuleCommand;
+                return CharacterSet;
             })();
     
-            return SplitflapCommand;
+            return SplitflapCharacterSets;
         })();
     
-        PB.SplitflapConfig = (function() {
+        PB.RequestState = (function() {
     
             /**
-             * Properties of a SplitflapConfig.
+             * Properties of a RequestState.
              * @memberof PB
-             * @interface ISplitflapConfig
-             * @property {Array.<PB.SplitflapConfig.IModuleConfig>|null} [modules] SplitflapConfig modules
+             * @interface IRequestState
              */
     
             /**
-             * Constructs a new SplitflapConfig.
+             * Constructs a new RequestState.
              * @memberof PB
-             * @classdesc Represents a SplitflapConfig.
-             * @implements ISplitflapConfig
+             * @classdesc Represents a RequestState.
+             * @implements IRequestState
              * @constructor
-             * @param {PB.ISplitflapConfig=} [properties] Properties to set
+             * @param {PB.IRequestState=} [properties] Properties to set
              */
-            function SplitflapConfig(properties) {
-                this.modules = [];
+            function RequestState(properties) {
                 if (properties)
                     for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                         if (properties[keys[i]] != null)
@@ -2606,79 +4616,63 @@
             }
     
             /**
-             * SplitflapConfig modules.
-             * @member {Array.<PB.SplitflapConfig.IModuleConfig>} modules
-             * @memberof PB.SplitflapConfig
-             * @instance
-             */
-            SplitflapConfig.prototype.modules = $util.emptyArray;
-    
-            /**
-             * Creates a new SplitflapConfig instance using the specified properties.
+             * Creates a new RequestState instance using the specified properties.
              * @function create
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.ISplitflapConfig=} [properties] Properties to set
-             * @returns {PB.SplitflapConfig} SplitflapConfig instance
+             * @param {PB.IRequestState=} [properties] Properties to set
+             * @returns {PB.RequestState} RequestState instance
              */
-            SplitflapConfig.create = function create(properties) {
-                return new SplitflapConfig(properties);
+            RequestState.create = function create(properties) {
+                return new RequestState(properties);
             };
     
             /**
-             * Encodes the specified SplitflapConfig message. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * Encodes the specified RequestState message. Does not implicitly {@link PB.RequestState.verify|verify} messages.
              * @function encode
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {PB.IRequestState} message RequestState message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SplitflapConfig.encode = function encode(message, writer) {
+            RequestState.encode = function encode(message, writer) {
                 if (!writer)
                     writer = $Writer.create();
-                if (message.modules != null && message.modules.length)
-                    for (var i = 0; i < message.modules.length; ++i)
-                        $root.PB.SplitflapConfig.ModuleConfig.encode(message.modules[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
                 return writer;
             };
     
             /**
-             * Encodes the specified SplitflapConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * Encodes the specified RequestState message, length delimited. Does not implicitly {@link PB.RequestState.verify|verify} messages.
              * @function encodeDelimited
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {PB.IRequestState} message RequestState message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SplitflapConfig.encodeDelimited = function encodeDelimited(message, writer) {
+            RequestState.encodeDelimited = function encodeDelimited(message, writer) {
                 return this.encode(message, writer).ldelim();
             };
     
             /**
-             * Decodes a SplitflapConfig message from the specified reader or buffer.
+             * Decodes a RequestState message from the specified reader or buffer.
              * @function decode
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
              * @param {number} [length] Message length if known beforehand
-             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @returns {PB.RequestState} RequestState
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapConfig.decode = function decode(reader, length) {
+            RequestState.decode = function decode(reader, length) {
                 if (!(reader instanceof $Reader))
                     reader = $Reader.create(reader);
-                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig();
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.RequestState();
                 while (reader.pos < end) {
                     var tag = reader.uint32();
                     switch (tag >>> 3) {
-                    case 1:
-                        if (!(message.modules && message.modules.length))
-                            message.modules = [];
-                        message.modules.push($root.PB.SplitflapConfig.ModuleConfig.decode(reader, reader.uint32()));
-                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -2688,352 +4682,234 @@
             };
     
             /**
-             * Decodes a SplitflapConfig message from the specified reader or buffer, length delimited.
+             * Decodes a RequestState message from the specified reader or buffer, length delimited.
              * @function decodeDelimited
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @returns {PB.RequestState} RequestState
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapConfig.decodeDelimited = function decodeDelimited(reader) {
+            RequestState.decodeDelimited = function decodeDelimited(reader) {
                 if (!(reader instanceof $Reader))
                     reader = new $Reader(reader);
                 return this.decode(reader, reader.uint32());
             };
     
             /**
-             * Verifies a SplitflapConfig message.
+             * Verifies a RequestState message.
              * @function verify
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
              * @param {Object.<string,*>} message Plain object to verify
              * @returns {string|null} `null` if valid, otherwise the reason why it is not
              */
-            SplitflapConfig.verify = function verify(message) {
+            RequestState.verify = function verify(message) {
                 if (typeof message !== "object" || message === null)
                     return "object expected";
-                if (message.modules != null && message.hasOwnProperty("modules")) {
-                    if (!Array.isArray(message.modules))
-                        return "modules: array expected";
-                    for (var i = 0; i < message.modules.length; ++i) {
-                        var error = $root.PB.SplitflapConfig.ModuleConfig.verify(message.modules[i]);
-                        if (error)
-                            return "modules." + error;
-                    }
-                }
                 return null;
             };
     
             /**
-             * Creates a SplitflapConfig message from a plain object. Also converts values to their respective internal types.
+             * Creates a RequestState message from a plain object. Also converts values to their respective internal types.
              * @function fromObject
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
              * @param {Object.<string,*>} object Plain object
-             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @returns {PB.RequestState} RequestState
              */
-            SplitflapConfig.fromObject = function fromObject(object) {
-                if (object instanceof $root.PB.SplitflapConfig)
+            RequestState.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.RequestState)
                     return object;
-                var message = new $root.PB.SplitflapConfig();
-                if (object.modules) {
-                    if (!Array.isArray(object.modules))
-                        throw TypeError(".PB.SplitflapConfig.modules: array expected");
-                    message.modules = [];
-                    for (var i = 0; i < object.modules.length; ++i) {
-                        if (typeof object.modules[i] !== "object")
-                            throw TypeError(".PB.SplitflapConfig.modules: object expected");
-                        message.modules[i] = $root.PB.SplitflapConfig.ModuleConfig.fromObject(object.modules[i]);
-                    }
-                }
-                return message;
+                return new $root.PB.RequestState();
             };
     
             /**
-             * Creates a plain object from a SplitflapConfig message. Also converts values to other types if specified.
+             * Creates a plain object from a RequestState message. Also converts values to other types if specified.
              * @function toObject
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.SplitflapConfig} message SplitflapConfig
+             * @param {PB.RequestState} message RequestState
              * @param {$protobuf.IConversionOptions} [options] Conversion options
              * @returns {Object.<string,*>} Plain object
              */
-            SplitflapConfig.toObject = function toObject(message, options) {
-                if (!options)
-                    options = {};
-                var object = {};
-                if (options.arrays || options.defaults)
-                    object.modules = [];
-                if (message.modules && message.modules.length) {
-                    object.modules = [];
-                    for (var j = 0; j < message.modules.length; ++j)
-                        object.modules[j] = $root.PB.SplitflapConfig.ModuleConfig.toObject(message.modules[j], options);
-                }
-                return object;
+            RequestState.toObject = function toObject() {
+                return {};
             };
     
             /**
-             * Converts this SplitflapConfig to JSON.
+             * Converts this RequestState to JSON.
              * @function toJSON
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.RequestState
              * @instance
              * @returns {Object.<string,*>} JSON object
              */
-            SplitflapConfig.prototype.toJSON = function toJSON() {
+            RequestState.prototype.toJSON = function toJSON() {
                 return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
             };
     
-            SplitflapConfig.ModuleConfig = (function() {
-    
-                /**
-                 * Properties of a ModuleConfig.
-                 * @memberof PB.SplitflapConfig
-                 * @interface IModuleConfig
-                 * @property {number|null} [targetFlapIndex] ModuleConfig targetFlapIndex
-                 * @property {number|null} [movementNonce] Value that triggers a movement upon change. If unused, only changes to target_flap_index
-                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
-                 * flap index.
-                 * 
-                 * NOTE: Must be < 256
-                 * @property {number|null} [resetNonce] Value that triggers a reset (clear error counters, re-home) upon change. If unused,
-                 * module will only re-home upon recoverable errors, and error counters will continue
-                 * to increase until overflow.
-                 * 
-                 * NOTE: Must be < 256
-                 */
-    
-                /**
-                 * Constructs a new ModuleConfig.
-                 * @memberof PB.SplitflapConfig
-                 * @classdesc Represents a ModuleConfig.
-                 * @implements IModuleConfig
-                 * @constructor
-                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
-                 */
-                function ModuleConfig(properties) {
-                    if (properties)
-                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
-                            if (properties[keys[i]] != null)
-                                this[keys[i]] = properties[keys[i]];
-                }
-    
-                /**
-                 * ModuleConfig targetFlapIndex.
-                 * @member {number} targetFlapIndex
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 */
-                ModuleConfig.prototype.targetFlapIndex = 0;
-    
-                /**
-                 * Value that triggers a movement upon change. If unused, only changes to target_flap_index
-                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
-                 * flap index.
-                 * 
-                 * NOTE: Must be < 256
-                 * @member {number} movementNonce
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 */
-                ModuleConfig.prototype.movementNonce = 0;
-    
-                /**
-                 * Value that triggers a reset (clear error counters, re-home) upon change. If unused,
-                 * module will only re-home upon recoverable errors, and error counters will continue
-                 * to increase until overflow.
-                 * 
-                 * NOTE: Must be < 256
-                 * @member {number} resetNonce
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 */
-                ModuleConfig.prototype.resetNonce = 0;
-    
-                /**
-                 * Creates a new ModuleConfig instance using the specified properties.
-                 * @function create
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig instance
-                 */
-                ModuleConfig.create = function create(properties) {
-                    return new ModuleConfig(properties);
-                };
+            return RequestState;
+        })();
     
-                /**
-                 * Encodes the specified ModuleConfig message. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
-                 * @function encode
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
-                 * @param {$protobuf.Writer} [writer] Writer to encode to
-                 * @returns {$protobuf.Writer} Writer
-                 */
-                ModuleConfig.encode = function encode(message, writer) {
-                    if (!writer)
-                        writer = $Writer.create();
-                    if (message.targetFlapIndex != null && Object.hasOwnProperty.call(message, "targetFlapIndex"))
-                        writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.targetFlapIndex);
-                    if (message.movementNonce != null && Object.hasOwnProperty.call(message, "movementNonce"))
-                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.movementNonce);
-                    if (message.resetNonce != null && Object.hasOwnProperty.call(message, "resetNonce"))
-                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.resetNonce);
-                    return writer;
-                };
+        PB.RequestTelemetry = (function() {
     
-                /**
-                 * Encodes the specified ModuleConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
-                 * @function encodeDelimited
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
-                 * @param {$protobuf.Writer} [writer] Writer to encode to
-                 * @returns {$protobuf.Writer} Writer
-                 */
-                ModuleConfig.encodeDelimited = function encodeDelimited(message, writer) {
-                    return this.encode(message, writer).ldelim();
-                };
+            /**
+             * Properties of a RequestTelemetry.
+             * @memberof PB
+             * @interface IRequestTelemetry
+             */
     
-                /**
-                 * Decodes a ModuleConfig message from the specified reader or buffer.
-                 * @function decode
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @param {number} [length] Message length if known beforehand
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
-                 * @throws {Error} If the payload is not a reader or valid buffer
-                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
-                 */
-                ModuleConfig.decode = function decode(reader, length) {
-                    if (!(reader instanceof $Reader))
-                        reader = $Reader.create(reader);
-                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig.ModuleConfig();
-                    while (reader.pos < end) {
-                        var tag = reader.uint32();
-                        switch (tag >>> 3) {
-                        case 1:
-                            message.targetFlapIndex = reader.uint32();
-                            break;
-                        case 2:
-                            message.movementNonce = reader.uint32();
-                            break;
-                        case 3:
-                            message.resetNonce = reader.uint32();
-                            break;
-                        default:
-                            reader.skipType(tag & 7);
-                            break;
-                        }
-                    }
-                    return message;
-                };
+            /**
+             * Constructs a new RequestTelemetry.
+             * @memberof PB
+             * @classdesc Represents a RequestTelemetry.
+             * @implements IRequestTelemetry
+             * @constructor
+             * @param {PB.IRequestTelemetry=} [properties] Properties to set
+             */
+            function RequestTelemetry(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
     
-                /**
-                 * Decodes a ModuleConfig message from the specified reader or buffer, length delimited.
-                 * @function decodeDelimited
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
-                 * @throws {Error} If the payload is not a reader or valid buffer
-                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
-                 */
-                ModuleConfig.decodeDelimited = function decodeDelimited(reader) {
-                    if (!(reader instanceof $Reader))
-                        reader = new $Reader(reader);
-                    return this.decode(reader, reader.uint32());
-                };
+            /**
+             * Creates a new RequestTelemetry instance using the specified properties.
+             * @function create
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {PB.IRequestTelemetry=} [properties] Properties to set
+             * @returns {PB.RequestTelemetry} RequestTelemetry instance
+             */
+            RequestTelemetry.create = function create(properties) {
+                return new RequestTelemetry(properties);
+            };
     
-                /**
-                 * Verifies a ModuleConfig message.
-                 * @function verify
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {Object.<string,*>} message Plain object to verify
-                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
-                 */
-                ModuleConfig.verify = function verify(message) {
-                    if (typeof message !== "object" || message === null)
-                        return "object expected";
-                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
-                        if (!$util.isInteger(message.targetFlapIndex))
-                            return "targetFlapIndex: integer expected";
-                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
-                        if (!$util.isInteger(message.movementNonce))
-                            return "movementNonce: integer expected";
-                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
-                        if (!$util.isInteger(message.resetNonce))
-                            return "resetNonce: integer expected";
-                    return null;
-                };
+            /**
+             * Encodes the specified RequestTelemetry message. Does not implicitly {@link PB.RequestTelemetry.verify|verify} messages.
+             * @function encode
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {PB.IRequestTelemetry} message RequestTelemetry message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            RequestTelemetry.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                return writer;
+            };
     
-                /**
-                 * Creates a ModuleConfig message from a plain object. Also converts values to their respective internal types.
-                 * @function fromObject
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {Object.<string,*>} object Plain object
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
-                 */
-                ModuleConfig.fromObject = function fromObject(object) {
-                    if (object instanceof $root.PB.SplitflapConfig.ModuleConfig)
-                        return object;
-                    var message = new $root.PB.SplitflapConfig.ModuleConfig();
-                    if (object.targetFlapIndex != null)
-                        message.targetFlapIndex = object.targetFlapIndex >>> 0;
-                    if (object.movementNonce != null)
-                        message.movementNonce = object.movementNonce >>> 0;
-                    if (object.resetNonce != null)
-                        message.resetNonce = object.resetNonce >>> 0;
-                    return message;
-                };
+            /**
+             * Encodes the specified RequestTelemetry message, length delimited. Does not implicitly {@link PB.RequestTelemetry.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {PB.IRequestTelemetry} message RequestTelemetry message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            RequestTelemetry.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
     
-                /**
-                 * Creates a plain object from a ModuleConfig message. Also converts values to other types if specified.
-                 * @function toObject
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.ModuleConfig} message ModuleConfig
-                 * @param {$protobuf.IConversionOptions} [options] Conversion options
-                 * @returns {Object.<string,*>} Plain object
-                 */
-                ModuleConfig.toObject = function toObject(message, options) {
-                    if (!options)
-                        options = {};
-                    var object = {};
-                    if (options.defaults) {
-                        object.targetFlapIndex = 0;
-                        object.movementNonce = 0;
-                        object.resetNonce = 0;
+            /**
+             * Decodes a RequestTelemetry message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.RequestTelemetry} RequestTelemetry
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            RequestTelemetry.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.RequestTelemetry();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
                     }
-                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
-                        object.targetFlapIndex = message.targetFlapIndex;
-                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
-                        object.movementNonce = message.movementNonce;
-                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
-                        object.resetNonce = message.resetNonce;
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a RequestTelemetry message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.RequestTelemetry} RequestTelemetry
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            RequestTelemetry.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a RequestTelemetry message.
+             * @function verify
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            RequestTelemetry.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                return null;
+            };
+    
+            /**
+             * Creates a RequestTelemetry message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.RequestTelemetry} RequestTelemetry
+             */
+            RequestTelemetry.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.RequestTelemetry)
                     return object;
-                };
+                return new $root.PB.RequestTelemetry();
+            };
     
-                /**
-                 * Converts this ModuleConfig to JSON.
-                 * @function toJSON
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 * @returns {Object.<string,*>} JSON object
-                 */
-                ModuleConfig.prototype.toJSON = function toJSON() {
-                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
-                };
+            /**
+             * Creates a plain object from a RequestTelemetry message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.RequestTelemetry
+             * @static
+             * @param {PB.RequestTelemetry} message RequestTelemetry
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            RequestTelemetry.toObject = function toObject() {
+                return {};
+            };
     
-                return ModuleConfig;
-            })();
+            /**
+             * Converts this RequestTelemetry to JSON.
+             * @function toJSON
+             * @memberof PB.RequestTelemetry
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            RequestTelemetry.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
     
-            return SplitflapConfig;
+            return RequestTelemetry;
         })();
     
         PB.ToSplitflap = (function() {
@@ -3045,6 +4921,10 @@
              * @property {number|null} [nonce] ToSplitflap nonce
              * @property {PB.ISplitflapCommand|null} [splitflapCommand] ToSplitflap splitflapCommand
              * @property {PB.ISplitflapConfig|null} [splitflapConfig] ToSplitflap splitflapConfig
+             * @property {PB.IRequestState|null} [requestState] ToSplitflap requestState
+             * @property {PB.ISplitflapSequence|null} [splitflapSequence] ToSplitflap splitflapSequence
+             * @property {PB.ISplitflapCharacterSets|null} [splitflapCharacterSets] ToSplitflap splitflapCharacterSets
+             * @property {PB.IRequestTelemetry|null} [requestTelemetry] ToSplitflap requestTelemetry
              */
     
             /**
@@ -3086,17 +4966,49 @@
              */
             ToSplitflap.prototype.splitflapConfig = null;
     
+            /**
+             * ToSplitflap requestState.
+             * @member {PB.IRequestState|null|undefined} requestState
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.requestState = null;
+    
+            /**
+             * ToSplitflap splitflapSequence.
+             * @member {PB.ISplitflapSequence|null|undefined} splitflapSequence
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.splitflapSequence = null;
+    
+            /**
+             * ToSplitflap splitflapCharacterSets.
+             * @member {PB.ISplitflapCharacterSets|null|undefined} splitflapCharacterSets
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.splitflapCharacterSets = null;
+    
+            /**
+             * ToSplitflap requestTelemetry.
+             * @member {PB.IRequestTelemetry|null|undefined} requestTelemetry
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.requestTelemetry = null;
+    
             // OneOf field names bound to virtual getters and setters
             var $oneOfFields;
     
             /**
              * ToSplitflap payload.
-             * @member {"splitflapCommand"|"splitflapConfig"|undefined} payload
+             * @member {"splitflapCommand"|"splitflapConfig"|"requestState"|"splitflapSequence"|"splitflapCharacterSets"|"requestTelemetry"|undefined} payload
              * @memberof PB.ToSplitflap
              * @instance
              */
             Object.defineProperty(ToSplitflap.prototype, "payload", {
-                get: $util.oneOfGetter($oneOfFields = ["splitflapCommand", "splitflapConfig"]),
+                get: $util.oneOfGetter($oneOfFields = ["splitflapCommand", "splitflapConfig", "requestState", "splitflapSequence", "splitflapCharacterSets", "requestTelemetry"]),
                 set: $util.oneOfSetter($oneOfFields)
             });
     
@@ -3130,6 +5042,14 @@
                     $root.PB.SplitflapCommand.encode(message.splitflapCommand, writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
                 if (message.splitflapConfig != null && Object.hasOwnProperty.call(message, "splitflapConfig"))
                     $root.PB.SplitflapConfig.encode(message.splitflapConfig, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
+                if (message.requestState != null && Object.hasOwnProperty.call(message, "requestState"))
+                    $root.PB.RequestState.encode(message.requestState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.splitflapSequence != null && Object.hasOwnProperty.call(message, "splitflapSequence"))
+                    $root.PB.SplitflapSequence.encode(message.splitflapSequence, writer.uint32(/* id 5, wireType 2 =*/42).fork()).ldelim();
+                if (message.splitflapCharacterSets != null && Object.hasOwnProperty.call(message, "splitflapCharacterSets"))
+                    $root.PB.SplitflapCharacterSets.encode(message.splitflapCharacterSets, writer.uint32(/* id 6, wireType 2 =*/50).fork()).ldelim();
+                if (message.requestTelemetry != null && Object.hasOwnProperty.call(message, "requestTelemetry"))
+                    $root.PB.RequestTelemetry.encode(message.requestTelemetry, writer.uint32(/* id 7, wireType 2 =*/58).fork()).ldelim();
                 return writer;
             };
     
@@ -3173,6 +5093,18 @@
                     case 3:
                         message.splitflapConfig = $root.PB.SplitflapConfig.decode(reader, reader.uint32());
                         break;
+                    case 4:
+                        message.requestState = $root.PB.RequestState.decode(reader, reader.uint32());
+                        break;
+                    case 5:
+                        message.splitflapSequence = $root.PB.SplitflapSequence.decode(reader, reader.uint32());
+                        break;
+                    case 6:
+                        message.splitflapCharacterSets = $root.PB.SplitflapCharacterSets.decode(reader, reader.uint32());
+                        break;
+                    case 7:
+                        message.requestTelemetry = $root.PB.RequestTelemetry.decode(reader, reader.uint32());
+                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -3230,6 +5162,46 @@
                             return "splitflapConfig." + error;
                     }
                 }
+                if (message.requestState != null && message.hasOwnProperty("requestState")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.RequestState.verify(message.requestState);
+                        if (error)
+                            return "requestState." + error;
+                    }
+                }
+                if (message.splitflapSequence != null && message.hasOwnProperty("splitflapSequence")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SplitflapSequence.verify(message.splitflapSequence);
+                        if (error)
+                            return "splitflapSequence." + error;
+                    }
+                }
+                if (message.splitflapCharacterSets != null && message.hasOwnProperty("splitflapCharacterSets")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SplitflapCharacterSets.verify(message.splitflapCharacterSets);
+                        if (error)
+                            return "splitflapCharacterSets." + error;
+                    }
+                }
+                if (message.requestTelemetry != null && message.hasOwnProperty("requestTelemetry")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.RequestTelemetry.verify(message.requestTelemetry);
+                        if (error)
+                            return "requestTelemetry." + error;
+                    }
+                }
                 return null;
             };
     
@@ -3257,6 +5229,26 @@
                         throw TypeError(".PB.ToSplitflap.splitflapConfig: object expected");
                     message.splitflapConfig = $root.PB.SplitflapConfig.fromObject(object.splitflapConfig);
                 }
+                if (object.requestState != null) {
+                    if (typeof object.requestState !== "object")
+                        throw TypeError(".PB.ToSplitflap.requestState: object expected");
+                    message.requestState = $root.PB.RequestState.fromObject(object.requestState);
+                }
+                if (object.splitflapSequence != null) {
+                    if (typeof object.splitflapSequence !== "object")
+                        throw TypeError(".PB.ToSplitflap.splitflapSequence: object expected");
+                    message.splitflapSequence = $root.PB.SplitflapSequence.fromObject(object.splitflapSequence);
+                }
+                if (object.splitflapCharacterSets != null) {
+                    if (typeof object.splitflapCharacterSets !== "object")
+                        throw TypeError(".PB.ToSplitflap.splitflapCharacterSets: object expected");
+                    message.splitflapCharacterSets = $root.PB.SplitflapCharacterSets.fromObject(object.splitflapCharacterSets);
+                }
+                if (object.requestTelemetry != null) {
+                    if (typeof object.requestTelemetry !== "object")
+                        throw TypeError(".PB.ToSplitflap.requestTelemetry: object expected");
+                    message.requestTelemetry = $root.PB.RequestTelemetry.fromObject(object.requestTelemetry);
+                }
                 return message;
             };
     
@@ -3287,6 +5279,26 @@
                     if (options.oneofs)
                         object.payload = "splitflapConfig";
                 }
+                if (message.requestState != null && message.hasOwnProperty("requestState")) {
+                    object.requestState = $root.PB.RequestState.toObject(message.requestState, options);
+                    if (options.oneofs)
+                        object.payload = "requestState";
+                }
+                if (message.splitflapSequence != null && message.hasOwnProperty("splitflapSequence")) {
+                    object.splitflapSequence = $root.PB.SplitflapSequence.toObject(message.splitflapSequence, options);
+                    if (options.oneofs)
+                        object.payload = "splitflapSequence";
+                }
+                if (message.splitflapCharacterSets != null && message.hasOwnProperty("splitflapCharacterSets")) {
+                    object.splitflapCharacterSets = $root.PB.SplitflapCharacterSets.toObject(message.splitflapCharacterSets, options);
+                    if (options.oneofs)
+                        object.payload = "splitflapCharacterSets";
+                }
+                if (message.requestTelemetry != null && message.hasOwnProperty("requestTelemetry")) {
+                    object.requestTelemetry = $root.PB.RequestTelemetry.toObject(message.requestTelemetry, options);
+                    if (options.oneofs)
+                        object.payload = "requestTelemetry";
+                }
                 return object;
             };
     
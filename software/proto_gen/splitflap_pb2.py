@@ -3,6 +3,7 @@
 
 import sys
 _b=sys.version_info[0]<3 and (lambda x:x) or (lambda x:x.encode('latin1'))
+from google.protobuf.internal import enum_type_wrapper
 from google.protobuf import descriptor as _descriptor
 from google.protobuf import message as _message
 from google.protobuf import reflection as _reflection
@@ -20,10 +21,45 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   package='PB',
   syntax='proto3',
   serialized_options=None,
-  serialized_pb=_b('\n\x0fsplitflap.proto\x12\x02PB\x1a\x0cnanopb.proto\"\xee\x02\n\x0eSplitflapState\x12\x37\n\x07modules\x18\x01 \x03(\x0b\x32\x1e.PB.SplitflapState.ModuleStateB\x06\x92?\x03\x10\xff\x01\x1a\xa2\x02\n\x0bModuleState\x12\x33\n\x05state\x18\x01 \x01(\x0e\x32$.PB.SplitflapState.ModuleState.State\x12\x19\n\nflap_index\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x0e\n\x06moving\x18\x03 \x01(\x08\x12\x12\n\nhome_state\x18\x04 \x01(\x08\x12$\n\x15\x63ount_unexpected_home\x18\x05 \x01(\rB\x05\x92?\x02\x38\x08\x12 \n\x11\x63ount_missed_home\x18\x06 \x01(\rB\x05\x92?\x02\x38\x08\"W\n\x05State\x12\n\n\x06NORMAL\x10\x00\x12\x11\n\rLOOK_FOR_HOME\x10\x01\x12\x10\n\x0cSENSOR_ERROR\x10\x02\x12\t\n\x05PANIC\x10\x03\x12\x12\n\x0eSTATE_DISABLED\x10\x04\"\x1a\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\"\x14\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\"\xa4\x05\n\x0fSupervisorState\x12\x15\n\ruptime_millis\x18\x01 \x01(\r\x12(\n\x05state\x18\x02 \x01(\x0e\x32\x19.PB.SupervisorState.State\x12\x44\n\x0epower_channels\x18\x03 \x03(\x0b\x32%.PB.SupervisorState.PowerChannelStateB\x05\x92?\x02\x10\x05\x12\x31\n\nfault_info\x18\x04 \x01(\x0b\x32\x1d.PB.SupervisorState.FaultInfo\x1aL\n\x11PowerChannelState\x12\x15\n\rvoltage_volts\x18\x01 \x01(\x02\x12\x14\n\x0c\x63urrent_amps\x18\x02 \x01(\x02\x12\n\n\x02on\x18\x03 \x01(\x08\x1a\x81\x02\n\tFaultInfo\x12\x35\n\x04type\x18\x01 \x01(\x0e\x32\'.PB.SupervisorState.FaultInfo.FaultType\x12\x13\n\x03msg\x18\x02 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x11\n\tts_millis\x18\x03 \x01(\r\"\x94\x01\n\tFaultType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x08\n\x04NONE\x10\x01\x12\x1e\n\x1aINRUSH_CURRENT_NOT_SETTLED\x10\x02\x12\x16\n\x12SPLITFLAP_SHUTDOWN\x10\x03\x12\x10\n\x0cOUT_OF_RANGE\x10\x04\x12\x10\n\x0cOVER_CURRENT\x10\x05\x12\x14\n\x10UNEXPECTED_POWER\x10\x06\"\x84\x01\n\x05State\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x1b\n\x17STARTING_VERIFY_PSU_OFF\x10\x01\x12\x1c\n\x18STARTING_VERIFY_VOLTAGES\x10\x02\x12\x1c\n\x18STARTING_ENABLE_CHANNELS\x10\x03\x12\n\n\x06NORMAL\x10\x04\x12\t\n\x05\x46\x41ULT\x10\x05\"\xaa\x01\n\rFromSplitflap\x12-\n\x0fsplitflap_state\x18\x01 \x01(\x0b\x32\x12.PB.SplitflapStateH\x00\x12\x16\n\x03log\x18\x02 \x01(\x0b\x32\x07.PB.LogH\x00\x12\x16\n\x03\x61\x63k\x18\x03 \x01(\x0b\x32\x07.PB.AckH\x00\x12/\n\x10supervisor_state\x18\x04 \x01(\x0b\x32\x13.PB.SupervisorStateH\x00\x42\t\n\x07payload\"\xeb\x01\n\x10SplitflapCommand\x12;\n\x07modules\x18\x02 \x03(\x0b\x32\".PB.SplitflapCommand.ModuleCommandB\x06\x92?\x03\x10\xff\x01\x1a\x99\x01\n\rModuleCommand\x12\x39\n\x06\x61\x63tion\x18\x01 \x01(\x0e\x32).PB.SplitflapCommand.ModuleCommand.Action\x12\x14\n\x05param\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\"7\n\x06\x41\x63tion\x12\t\n\x05NO_OP\x10\x00\x12\x0e\n\nGO_TO_FLAP\x10\x01\x12\x12\n\x0eRESET_AND_HOME\x10\x02\"\xb9\x01\n\x0fSplitflapConfig\x12\x39\n\x07modules\x18\x01 \x03(\x0b\x32 .PB.SplitflapConfig.ModuleConfigB\x06\x92?\x03\x10\xff\x01\x1ak\n\x0cModuleConfig\x12 \n\x11target_flap_index\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1d\n\x0emovement_nonce\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1a\n\x0breset_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\"\x0e\n\x0cRequestState\"\xb6\x01\n\x0bToSplitflap\x12\r\n\x05nonce\x18\x01 \x01(\r\x12\x31\n\x11splitflap_command\x18\x02 \x01(\x0b\x32\x14.PB.SplitflapCommandH\x00\x12/\n\x10splitflap_config\x18\x03 \x01(\x0b\x32\x13.PB.SplitflapConfigH\x00\x12)\n\rrequest_state\x18\x04 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x42\t\n\x07payloadb\x06proto3')
+  serialized_pb=_b('\n\x0fsplitflap.proto\x12\x02PB\x1a\x0cnanopb.proto\"\xee\x02\n\x0eSplitflapState\x12\x37\n\x07modules\x18\x01 \x03(\x0b\x32\x1e.PB.SplitflapState.ModuleStateB\x06\x92?\x03\x10\xff\x01\x1a\xa2\x02\n\x0bModuleState\x12\x33\n\x05state\x18\x01 \x01(\x0e\x32$.PB.SplitflapState.ModuleState.State\x12\x19\n\nflap_index\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x0e\n\x06moving\x18\x03 \x01(\x08\x12\x12\n\nhome_state\x18\x04 \x01(\x08\x12$\n\x15\x63ount_unexpected_home\x18\x05 \x01(\rB\x05\x92?\x02\x38\x08\x12 \n\x11\x63ount_missed_home\x18\x06 \x01(\rB\x05\x92?\x02\x38\x08\"W\n\x05State\x12\n\n\x06NORMAL\x10\x00\x12\x11\n\rLOOK_FOR_HOME\x10\x01\x12\x10\n\x0cSENSOR_ERROR\x10\x02\x12\t\n\x05PANIC\x10\x03\x12\x12\n\x0eSTATE_DISABLED\x10\x04\"\x1a\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\"\x14\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\"\xa4\x05\n\x0fSupervisorState\x12\x15\n\ruptime_millis\x18\x01 \x01(\r\x12(\n\x05state\x18\x02 \x01(\x0e\x32\x19.PB.SupervisorState.State\x12\x44\n\x0epower_channels\x18\x03 \x03(\x0b\x32%.PB.SupervisorState.PowerChannelStateB\x05\x92?\x02\x10\x05\x12\x31\n\nfault_info\x18\x04 \x01(\x0b\x32\x1d.PB.SupervisorState.FaultInfo\x1aL\n\x11PowerChannelState\x12\x15\n\rvoltage_volts\x18\x01 \x01(\x02\x12\x14\n\x0c\x63urrent_amps\x18\x02 \x01(\x02\x12\n\n\x02on\x18\x03 \x01(\x08\x1a\x81\x02\n\tFaultInfo\x12\x35\n\x04type\x18\x01 \x01(\x0e\x32\'.PB.SupervisorState.FaultInfo.FaultType\x12\x13\n\x03msg\x18\x02 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x11\n\tts_millis\x18\x03 \x01(\r\"\x94\x01\n\tFaultType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x08\n\x04NONE\x10\x01\x12\x1e\n\x1aINRUSH_CURRENT_NOT_SETTLED\x10\x02\x12\x16\n\x12SPLITFLAP_SHUTDOWN\x10\x03\x12\x10\n\x0cOUT_OF_RANGE\x10\x04\x12\x10\n\x0cOVER_CURRENT\x10\x05\x12\x14\n\x10UNEXPECTED_POWER\x10\x06\"\x84\x01\n\x05State\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x1b\n\x17STARTING_VERIFY_PSU_OFF\x10\x01\x12\x1c\n\x18STARTING_VERIFY_VOLTAGES\x10\x02\x12\x1c\n\x18STARTING_ENABLE_CHANNELS\x10\x03\x12\n\n\x06NORMAL\x10\x04\x12\t\n\x05\x46\x41ULT\x10\x05\"\x95\x02\n\x12SplitflapTelemetry\x12?\n\x07modules\x18\x01 \x03(\x0b\x32&.PB.SplitflapTelemetry.ModuleTelemetryB\x06\x92?\x03\x10\xff\x01\x12\x1c\n\x14io_frames_per_second\x18\x02 \x01(\r\x12\x0f\n\x07io_idle\x18\x03 \x01(\x08\x12\x1d\n\x15loopback_check_millis\x18\x04 \x01(\r\x1ap\n\x0fModuleTelemetry\x12(\n\x14home_error_histogram\x18\x01 \x03(\rB\n\x92?\x02\x10\x07\x92?\x02\x38\x10\x12\x12\n\nrecoveries\x18\x02 \x01(\r\x12\x1f\n\x17millis_since_last_error\x18\x03 \x01(\r\"\xe1\x01\n\rFromSplitflap\x12-\n\x0fsplitflap_state\x18\x01 \x01(\x0b\x32\x12.PB.SplitflapStateH\x00\x12\x16\n\x03log\x18\x02 \x01(\x0b\x32\x07.PB.LogH\x00\x12\x16\n\x03\x61\x63k\x18\x03 \x01(\x0b\x32\x07.PB.AckH\x00\x12/\n\x10supervisor_state\x18\x04 \x01(\x0b\x32\x13.PB.SupervisorStateH\x00\x12\x35\n\x13splitflap_telemetry\x18\x05 \x01(\x0b\x32\x16.PB.SplitflapTelemetryH\x00\x42\t\n\x07payload\"\x96\x02\n\x10SplitflapCommand\x12;\n\x07modules\x18\x02 \x03(\x0b\x32\".PB.SplitflapCommand.ModuleCommandB\x06\x92?\x03\x10\xff\x01\x1a\xc4\x01\n\rModuleCommand\x12\x39\n\x06\x61\x63tion\x18\x01 \x01(\x0e\x32).PB.SplitflapCommand.ModuleCommand.Action\x12\x14\n\x05param\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12)\n\x0emotion_profile\x18\x03 \x01(\x0e\x32\x11.PB.MotionProfile\"7\n\x06\x41\x63tion\x12\t\n\x05NO_OP\x10\x00\x12\x0e\n\nGO_TO_FLAP\x10\x01\x12\x12\n\x0eRESET_AND_HOME\x10\x02\"\xe5\x01\n\x0fSplitflapConfig\x12\x39\n\x07modules\x18\x01 \x03(\x0b\x32 .PB.SplitflapConfig.ModuleConfigB\x06\x92?\x03\x10\xff\x01\x1a\x96\x01\n\x0cModuleConfig\x12 \n\x11target_flap_index\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1d\n\x0emovement_nonce\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1a\n\x0breset_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\x12)\n\x0emotion_profile\x18\x04 \x01(\x0e\x32\x11.PB.MotionProfile\"\x97\x01\n\x11SplitflapSequence\x12=\n\x07modules\x18\x01 \x03(\x0b\x32$.PB.SplitflapSequence.ModuleSequenceB\x06\x92?\x03\x10\xff\x01\x12\x14\n\x0c\x64well_millis\x18\x02 \x01(\r\x1a-\n\x0eModuleSequence\x12\x1b\n\x0c\x66lap_indices\x18\x01 \x01(\x0c\x42\x05\x92?\x02\x08\x08\"\xad\x01\n\x16SplitflapCharacterSets\x12\x46\n\x0e\x63haracter_sets\x18\x01 \x03(\x0b\x32\'.PB.SplitflapCharacterSets.CharacterSetB\x05\x92?\x02\x10\x04\x12%\n\x15module_character_sets\x18\x02 \x01(\x0c\x42\x06\x92?\x03\x08\xff\x01\x1a$\n\x0c\x43haracterSet\x12\x14\n\x05\x66laps\x18\x01 \x01(\x0c\x42\x05\x92?\x02\x08\x34\"\x0e\n\x0cRequestState\"\x12\n\x10RequestTelemetry\"\xde\x02\n\x0bToSplitflap\x12\r\n\x05nonce\x18\x01 \x01(\r\x12\x31\n\x11splitflap_command\x18\x02 \x01(\x0b\x32\x14.PB.SplitflapCommandH\x00\x12/\n\x10splitflap_config\x18\x03 \x01(\x0b\x32\x13.PB.SplitflapConfigH\x00\x12)\n\rrequest_state\x18\x04 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x12\x33\n\x12splitflap_sequence\x18\x05 \x01(\x0b\x32\x15.PB.SplitflapSequenceH\x00\x12>\n\x18splitflap_character_sets\x18\x06 \x01(\x0b\x32\x1a.PB.SplitflapCharacterSetsH\x00\x12\x31\n\x11request_telemetry\x18\x07 \x01(\x0b\x32\x14.PB.RequestTelemetryH\x00\x42\t\n\x07payload*\x82\x01\n\rMotionProfile\x12\x1a\n\x16MOTION_PROFILE_DEFAULT\x10\x00\x12\x18\n\x14MOTION_PROFILE_QUIET\x10\x01\x12\x1a\n\x16MOTION_PROFILE_S_CURVE\x10\x02\x12\x1f\n\x1bMOTION_PROFILE_S_CURVE_FAST\x10\x03\x62\x06proto3')
   ,
   dependencies=[nanopb__pb2.DESCRIPTOR,])
 
+_MOTIONPROFILE = _descriptor.EnumDescriptor(
+  name='MotionProfile',
+  full_name='PB.MotionProfile',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='MOTION_PROFILE_DEFAULT', index=0, number=0,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='MOTION_PROFILE_QUIET', index=1, number=1,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='MOTION_PROFILE_S_CURVE', index=2, number=2,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='MOTION_PROFILE_S_CURVE_FAST', index=3, number=3,
+      serialized_options=None,
+      type=None),
+  ],
+  containing_type=None,
+  serialized_options=None,
+  serialized_start=2876,
+  serialized_end=3006,
+)
+_sym_db.RegisterEnumDescriptor(_MOTIONPROFILE)
+
+MotionProfile = enum_type_wrapper.EnumTypeWrapper(_MOTIONPROFILE)
+MOTION_PROFILE_DEFAULT = 0
+MOTION_PROFILE_QUIET = 1
+MOTION_PROFILE_S_CURVE = 2
+MOTION_PROFILE_S_CURVE_FAST = 3
 
 
 _SPLITFLAPSTATE_MODULESTATE_STATE = _descriptor.EnumDescriptor(
@@ -161,8 +197,8 @@ _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   serialized_options=None,
-  serialized_start=1489,
-  serialized_end=1544,
+  serialized_start=1867,
+  serialized_end=1922,
 )
 _sym_db.RegisterEnumDescriptor(_SPLITFLAPCOMMAND_MODULECOMMAND_ACTION)
 
@@ -468,6 +504,102 @@ _SUPERVISORSTATE = _descriptor.Descriptor(
 )
 
 
+_SPLITFLAPTELEMETRY_MODULETELEMETRY = _descriptor.Descriptor(
+  name='ModuleTelemetry',
+  full_name='PB.SplitflapTelemetry.ModuleTelemetry',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='home_error_histogram', full_name='PB.SplitflapTelemetry.ModuleTelemetry.home_error_histogram', index=0,
+      number=1, type=13, cpp_type=3, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\002\020\007\222?\0028\020'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='recoveries', full_name='PB.SplitflapTelemetry.ModuleTelemetry.recoveries', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='millis_since_last_error', full_name='PB.SplitflapTelemetry.ModuleTelemetry.millis_since_last_error', index=2,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=1301,
+  serialized_end=1413,
+)
+
+_SPLITFLAPTELEMETRY = _descriptor.Descriptor(
+  name='SplitflapTelemetry',
+  full_name='PB.SplitflapTelemetry',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='modules', full_name='PB.SplitflapTelemetry.modules', index=0,
+      number=1, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='io_frames_per_second', full_name='PB.SplitflapTelemetry.io_frames_per_second', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='io_idle', full_name='PB.SplitflapTelemetry.io_idle', index=2,
+      number=3, type=8, cpp_type=7, label=1,
+      has_default_value=False, default_value=False,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='loopback_check_millis', full_name='PB.SplitflapTelemetry.loopback_check_millis', index=3,
+      number=4, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[_SPLITFLAPTELEMETRY_MODULETELEMETRY, ],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=1136,
+  serialized_end=1413,
+)
+
+
 _FROMSPLITFLAP = _descriptor.Descriptor(
   name='FromSplitflap',
   full_name='PB.FromSplitflap',
@@ -503,6 +635,13 @@ _FROMSPLITFLAP = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='splitflap_telemetry', full_name='PB.FromSplitflap.splitflap_telemetry', index=4,
+      number=5, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -518,8 +657,8 @@ _FROMSPLITFLAP = _descriptor.Descriptor(
       name='payload', full_name='PB.FromSplitflap.payload',
       index=0, containing_type=None, fields=[]),
   ],
-  serialized_start=1136,
-  serialized_end=1306,
+  serialized_start=1416,
+  serialized_end=1641,
 )
 
 
@@ -544,6 +683,13 @@ _SPLITFLAPCOMMAND_MODULECOMMAND = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='motion_profile', full_name='PB.SplitflapCommand.ModuleCommand.motion_profile', index=2,
+      number=3, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -557,8 +703,8 @@ _SPLITFLAPCOMMAND_MODULECOMMAND = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1391,
-  serialized_end=1544,
+  serialized_start=1726,
+  serialized_end=1922,
 )
 
 _SPLITFLAPCOMMAND = _descriptor.Descriptor(
@@ -587,8 +733,8 @@ _SPLITFLAPCOMMAND = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1309,
-  serialized_end=1544,
+  serialized_start=1644,
+  serialized_end=1922,
 )
 
 
@@ -620,6 +766,13 @@ _SPLITFLAPCONFIG_MODULECONFIG = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='motion_profile', full_name='PB.SplitflapConfig.ModuleConfig.motion_profile', index=3,
+      number=4, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -632,8 +785,8 @@ _SPLITFLAPCONFIG_MODULECONFIG = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1625,
-  serialized_end=1732,
+  serialized_start=2004,
+  serialized_end=2154,
 )
 
 _SPLITFLAPCONFIG = _descriptor.Descriptor(
@@ -662,8 +815,144 @@ _SPLITFLAPCONFIG = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1547,
-  serialized_end=1732,
+  serialized_start=1925,
+  serialized_end=2154,
+)
+
+
+_SPLITFLAPSEQUENCE_MODULESEQUENCE = _descriptor.Descriptor(
+  name='ModuleSequence',
+  full_name='PB.SplitflapSequence.ModuleSequence',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='flap_indices', full_name='PB.SplitflapSequence.ModuleSequence.flap_indices', index=0,
+      number=1, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\002\010\010'), file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2263,
+  serialized_end=2308,
+)
+
+_SPLITFLAPSEQUENCE = _descriptor.Descriptor(
+  name='SplitflapSequence',
+  full_name='PB.SplitflapSequence',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='modules', full_name='PB.SplitflapSequence.modules', index=0,
+      number=1, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='dwell_millis', full_name='PB.SplitflapSequence.dwell_millis', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[_SPLITFLAPSEQUENCE_MODULESEQUENCE, ],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2157,
+  serialized_end=2308,
+)
+
+
+_SPLITFLAPCHARACTERSETS_CHARACTERSET = _descriptor.Descriptor(
+  name='CharacterSet',
+  full_name='PB.SplitflapCharacterSets.CharacterSet',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='flaps', full_name='PB.SplitflapCharacterSets.CharacterSet.flaps', index=0,
+      number=1, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\002\0104'), file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2448,
+  serialized_end=2484,
+)
+
+_SPLITFLAPCHARACTERSETS = _descriptor.Descriptor(
+  name='SplitflapCharacterSets',
+  full_name='PB.SplitflapCharacterSets',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='character_sets', full_name='PB.SplitflapCharacterSets.character_sets', index=0,
+      number=1, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\002\020\004'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='module_character_sets', full_name='PB.SplitflapCharacterSets.module_character_sets', index=1,
+      number=2, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\003\010\377\001'), file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[_SPLITFLAPCHARACTERSETS_CHARACTERSET, ],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2311,
+  serialized_end=2484,
 )
 
 
@@ -686,8 +975,32 @@ _REQUESTSTATE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1734,
-  serialized_end=1748,
+  serialized_start=2486,
+  serialized_end=2500,
+)
+
+
+_REQUESTTELEMETRY = _descriptor.Descriptor(
+  name='RequestTelemetry',
+  full_name='PB.RequestTelemetry',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2502,
+  serialized_end=2520,
 )
 
 
@@ -726,6 +1039,27 @@ _TOSPLITFLAP = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='splitflap_sequence', full_name='PB.ToSplitflap.splitflap_sequence', index=4,
+      number=5, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='splitflap_character_sets', full_name='PB.ToSplitflap.splitflap_character_sets', index=5,
+      number=6, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='request_telemetry', full_name='PB.ToSplitflap.request_telemetry', index=6,
+      number=7, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -741,8 +1075,8 @@ _TOSPLITFLAP = _descriptor.Descriptor(
       name='payload', full_name='PB.ToSplitflap.payload',
       index=0, containing_type=None, fields=[]),
   ],
-  serialized_start=1751,
-  serialized_end=1933,
+  serialized_start=2523,
+  serialized_end=2873,
 )
 
 _SPLITFLAPSTATE_MODULESTATE.fields_by_name['state'].enum_type = _SPLITFLAPSTATE_MODULESTATE_STATE
@@ -757,10 +1091,13 @@ _SUPERVISORSTATE.fields_by_name['state'].enum_type = _SUPERVISORSTATE_STATE
 _SUPERVISORSTATE.fields_by_name['power_channels'].message_type = _SUPERVISORSTATE_POWERCHANNELSTATE
 _SUPERVISORSTATE.fields_by_name['fault_info'].message_type = _SUPERVISORSTATE_FAULTINFO
 _SUPERVISORSTATE_STATE.containing_type = _SUPERVISORSTATE
+_SPLITFLAPTELEMETRY_MODULETELEMETRY.containing_type = _SPLITFLAPTELEMETRY
+_SPLITFLAPTELEMETRY.fields_by_name['modules'].message_type = _SPLITFLAPTELEMETRY_MODULETELEMETRY
 _FROMSPLITFLAP.fields_by_name['splitflap_state'].message_type = _SPLITFLAPSTATE
 _FROMSPLITFLAP.fields_by_name['log'].message_type = _LOG
 _FROMSPLITFLAP.fields_by_name['ack'].message_type = _ACK
 _FROMSPLITFLAP.fields_by_name['supervisor_state'].message_type = _SUPERVISORSTATE
+_FROMSPLITFLAP.fields_by_name['splitflap_telemetry'].message_type = _SPLITFLAPTELEMETRY
 _FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _FROMSPLITFLAP.fields_by_name['splitflap_state'])
 _FROMSPLITFLAP.fields_by_name['splitflap_state'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
@@ -773,15 +1110,27 @@ _FROMSPLITFLAP.fields_by_name['ack'].containing_oneof = _FROMSPLITFLAP.oneofs_by
 _FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _FROMSPLITFLAP.fields_by_name['supervisor_state'])
 _FROMSPLITFLAP.fields_by_name['supervisor_state'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
+_FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _FROMSPLITFLAP.fields_by_name['splitflap_telemetry'])
+_FROMSPLITFLAP.fields_by_name['splitflap_telemetry'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
 _SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['action'].enum_type = _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION
+_SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['motion_profile'].enum_type = _MOTIONPROFILE
 _SPLITFLAPCOMMAND_MODULECOMMAND.containing_type = _SPLITFLAPCOMMAND
 _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION.containing_type = _SPLITFLAPCOMMAND_MODULECOMMAND
 _SPLITFLAPCOMMAND.fields_by_name['modules'].message_type = _SPLITFLAPCOMMAND_MODULECOMMAND
+_SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['motion_profile'].enum_type = _MOTIONPROFILE
 _SPLITFLAPCONFIG_MODULECONFIG.containing_type = _SPLITFLAPCONFIG
 _SPLITFLAPCONFIG.fields_by_name['modules'].message_type = _SPLITFLAPCONFIG_MODULECONFIG
+_SPLITFLAPSEQUENCE_MODULESEQUENCE.containing_type = _SPLITFLAPSEQUENCE
+_SPLITFLAPSEQUENCE.fields_by_name['modules'].message_type = _SPLITFLAPSEQUENCE_MODULESEQUENCE
+_SPLITFLAPCHARACTERSETS_CHARACTERSET.containing_type = _SPLITFLAPCHARACTERSETS
+_SPLITFLAPCHARACTERSETS.fields_by_name['character_sets'].message_type = _SPLITFLAPCHARACTERSETS_CHARACTERSET
 _TOSPLITFLAP.fields_by_name['splitflap_command'].message_type = _SPLITFLAPCOMMAND
 _TOSPLITFLAP.fields_by_name['splitflap_config'].message_type = _SPLITFLAPCONFIG
 _TOSPLITFLAP.fields_by_name['request_state'].message_type = _REQUESTSTATE
+_TOSPLITFLAP.fields_by_name['splitflap_sequence'].message_type = _SPLITFLAPSEQUENCE
+_TOSPLITFLAP.fields_by_name['splitflap_character_sets'].message_type = _SPLITFLAPCHARACTERSETS
+_TOSPLITFLAP.fields_by_name['request_telemetry'].message_type = _REQUESTTELEMETRY
 _TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _TOSPLITFLAP.fields_by_name['splitflap_command'])
 _TOSPLITFLAP.fields_by_name['splitflap_command'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
@@ -791,15 +1140,29 @@ _TOSPLITFLAP.fields_by_name['splitflap_config'].containing_oneof = _TOSPLITFLAP.
 _TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _TOSPLITFLAP.fields_by_name['request_state'])
 _TOSPLITFLAP.fields_by_name['request_state'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
+_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _TOSPLITFLAP.fields_by_name['splitflap_sequence'])
+_TOSPLITFLAP.fields_by_name['splitflap_sequence'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
+_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _TOSPLITFLAP.fields_by_name['splitflap_character_sets'])
+_TOSPLITFLAP.fields_by_name['splitflap_character_sets'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
+_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _TOSPLITFLAP.fields_by_name['request_telemetry'])
+_TOSPLITFLAP.fields_by_name['request_telemetry'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
 DESCRIPTOR.message_types_by_name['SplitflapState'] = _SPLITFLAPSTATE
 DESCRIPTOR.message_types_by_name['Log'] = _LOG
 DESCRIPTOR.message_types_by_name['Ack'] = _ACK
 DESCRIPTOR.message_types_by_name['SupervisorState'] = _SUPERVISORSTATE
+DESCRIPTOR.message_types_by_name['SplitflapTelemetry'] = _SPLITFLAPTELEMETRY
 DESCRIPTOR.message_types_by_name['FromSplitflap'] = _FROMSPLITFLAP
 DESCRIPTOR.message_types_by_name['SplitflapCommand'] = _SPLITFLAPCOMMAND
 DESCRIPTOR.message_types_by_name['SplitflapConfig'] = _SPLITFLAPCONFIG
+DESCRIPTOR.message_types_by_name['SplitflapSequence'] = _SPLITFLAPSEQUENCE
+DESCRIPTOR.message_types_by_name['SplitflapCharacterSets'] = _SPLITFLAPCHARACTERSETS
 DESCRIPTOR.message_types_by_name['RequestState'] = _REQUESTSTATE
+DESCRIPTOR.message_types_by_name['RequestTelemetry'] = _REQUESTTELEMETRY
 DESCRIPTOR.message_types_by_name['ToSplitflap'] = _TOSPLITFLAP
+DESCRIPTOR.enum_types_by_name['MotionProfile'] = _MOTIONPROFILE
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
 SplitflapState = _reflection.GeneratedProtocolMessageType('SplitflapState', (_message.Message,), dict(
@@ -854,6 +1217,21 @@ _sym_db.RegisterMessage(SupervisorState)
 _sym_db.RegisterMessage(SupervisorState.PowerChannelState)
 _sym_db.RegisterMessage(SupervisorState.FaultInfo)
 
+SplitflapTelemetry = _reflection.GeneratedProtocolMessageType('SplitflapTelemetry', (_message.Message,), dict(
+
+  ModuleTelemetry = _reflection.GeneratedProtocolMessageType('ModuleTelemetry', (_message.Message,), dict(
+    DESCRIPTOR = _SPLITFLAPTELEMETRY_MODULETELEMETRY,
+    __module__ = 'splitflap_pb2'
+    # @@protoc_insertion_point(class_scope:PB.SplitflapTelemetry.ModuleTelemetry)
+    ))
+  ,
+  DESCRIPTOR = _SPLITFLAPTELEMETRY,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.SplitflapTelemetry)
+  ))
+_sym_db.RegisterMessage(SplitflapTelemetry)
+_sym_db.RegisterMessage(SplitflapTelemetry.ModuleTelemetry)
+
 FromSplitflap = _reflection.GeneratedProtocolMessageType('FromSplitflap', (_message.Message,), dict(
   DESCRIPTOR = _FROMSPLITFLAP,
   __module__ = 'splitflap_pb2'
@@ -891,6 +1269,36 @@ SplitflapConfig = _reflection.GeneratedProtocolMessageType('SplitflapConfig', (_
 _sym_db.RegisterMessage(SplitflapConfig)
 _sym_db.RegisterMessage(SplitflapConfig.ModuleConfig)
 
+SplitflapSequence = _reflection.GeneratedProtocolMessageType('SplitflapSequence', (_message.Message,), dict(
+
+  ModuleSequence = _reflection.GeneratedProtocolMessageType('ModuleSequence', (_message.Message,), dict(
+    DESCRIPTOR = _SPLITFLAPSEQUENCE_MODULESEQUENCE,
+    __module__ = 'splitflap_pb2'
+    # @@protoc_insertion_point(class_scope:PB.SplitflapSequence.ModuleSequence)
+    ))
+  ,
+  DESCRIPTOR = _SPLITFLAPSEQUENCE,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.SplitflapSequence)
+  ))
+_sym_db.RegisterMessage(SplitflapSequence)
+_sym_db.RegisterMessage(SplitflapSequence.ModuleSequence)
+
+SplitflapCharacterSets = _reflection.GeneratedProtocolMessageType('SplitflapCharacterSets', (_message.Message,), dict(
+
+  CharacterSet = _reflection.GeneratedProtocolMessageType('CharacterSet', (_message.Message,), dict(
+    DESCRIPTOR = _SPLITFLAPCHARACTERSETS_CHARACTERSET,
+    __module__ = 'splitflap_pb2'
+    # @@protoc_insertion_point(class_scope:PB.SplitflapCharacterSets.CharacterSet)
+    ))
+  ,
+  DESCRIPTOR = _SPLITFLAPCHARACTERSETS,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.SplitflapCharacterSets)
+  ))
+_sym_db.RegisterMessage(SplitflapCharacterSets)
+_sym_db.RegisterMessage(SplitflapCharacterSets.CharacterSet)
+
 RequestState = _reflection.GeneratedProtocolMessageType('RequestState', (_message.Message,), dict(
   DESCRIPTOR = _REQUESTSTATE,
   __module__ = 'splitflap_pb2'
@@ -898,6 +1306,13 @@ RequestState = _reflection.GeneratedProtocolMessageType('RequestState', (_messag
   ))
 _sym_db.RegisterMessage(RequestState)
 
+RequestTelemetry = _reflection.GeneratedProtocolMessageType('RequestTelemetry', (_message.Message,), dict(
+  DESCRIPTOR = _REQUESTTELEMETRY,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.RequestTelemetry)
+  ))
+_sym_db.RegisterMessage(RequestTelemetry)
+
 ToSplitflap = _reflection.GeneratedProtocolMessageType('ToSplitflap', (_message.Message,), dict(
   DESCRIPTOR = _TOSPLITFLAP,
   __module__ = 'splitflap_pb2'
@@ -913,10 +1328,17 @@ _SPLITFLAPSTATE.fields_by_name['modules']._options = None
 _LOG.fields_by_name['msg']._options = None
 _SUPERVISORSTATE_FAULTINFO.fields_by_name['msg']._options = None
 _SUPERVISORSTATE.fields_by_name['power_channels']._options = None
+_SPLITFLAPTELEMETRY_MODULETELEMETRY.fields_by_name['home_error_histogram']._options = None
+_SPLITFLAPTELEMETRY.fields_by_name['modules']._options = None
 _SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['param']._options = None
 _SPLITFLAPCOMMAND.fields_by_name['modules']._options = None
 _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['target_flap_index']._options = None
 _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['movement_nonce']._options = None
 _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['reset_nonce']._options = None
 _SPLITFLAPCONFIG.fields_by_name['modules']._options = None
+_SPLITFLAPSEQUENCE_MODULESEQUENCE.fields_by_name['flap_indices']._options = None
+_SPLITFLAPSEQUENCE.fields_by_name['modules']._options = None
+_SPLITFLAPCHARACTERSETS_CHARACTERSET.fields_by_name['flaps']._options = None
+_SPLITFLAPCHARACTERSETS.fields_by_name['character_sets']._options = None
+_SPLITFLAPCHARACTERSETS.fields_by_name['module_character_sets']._options = None
 # @@protoc_insertion_point(module_scope)